@@ -0,0 +1,93 @@
+/**
+ * @file bench.hpp
+ * @author jiskim
+ * @brief benchmark helpers
+ * @date 2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <time.h>
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#define BENCH_CYAN "\033[1;96m"
+#define BENCH_RESET "\033[0m"
+
+/**
+ * @brief monotonic clock 으로 경과 시간을 잰다.
+ */
+class bench_timer {
+ private:
+  struct timespec _start;
+
+ public:
+  bench_timer(void) { reset(); }
+
+  void reset(void) { clock_gettime(CLOCK_MONOTONIC, &_start); }
+
+  /**
+   * @brief reset 이후 경과한 시간
+   *
+   * @return double milliseconds
+   */
+  double elapsed_ms(void) const {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - _start.tv_sec) * 1e3 +
+           (now.tv_nsec - _start.tv_nsec) / 1e6;
+  }
+};
+
+/**
+ * @brief 짧은 구간을 재기 위한 monotonic clock 의 현재 시각
+ *
+ * @return long nanoseconds
+ */
+inline long bench_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+inline void bench_title(const std::string& title) {
+  std::cout << BENCH_CYAN << "\n========== " << title << " ==========\n"
+            << BENCH_RESET;
+}
+
+inline void bench_report(const std::string& label, double ms) {
+  std::cout << std::left << std::setw(40) << label << std::right
+            << std::setw(12) << std::fixed << std::setprecision(3) << ms
+            << " ms\n";
+}
+
+/**
+ * @brief 최적화로 결과가 지워지지 않도록 값을 소비한다.
+ */
+template <typename T>
+inline void bench_consume(const T& value) {
+  static volatile T sink;
+  sink = value;
+  (void)sink;
+}
+
+void vector_bench(void);
+void growth_bench(void);
+void huge_page_bench(void);
+void parallel_bench(void);
+void latency_bench(void);
+void deque_bench(void);
+void concurrent_bench(void);
+void io_bench(void);
+void mapped_bench(void);
+void cow_bench(void);
+void soa_bench(void);
+void packed_bench(void);
+
+#endif  // BENCH_HPP
@@ -0,0 +1,118 @@
+/**
+ * @file concurrent_bench.cpp
+ * @author jiskim
+ * @brief concurrent_vector push_back scaling vs mutex-merged vectors
+ * @date 2023-02-22
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <cstdlib>
+
+#include "bench.hpp"
+#include "concurrent_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kItems = 16 * 1000 * 1000;
+
+struct shared_state {
+  size_t per_thread;
+  ft::concurrent_vector<long> concurrent;
+  ft::vector<long> merged;
+  pthread_mutex_t lock;
+};
+
+/**
+ * @brief 모든 thread 가 하나의 concurrent_vector 에 바로 push_back 한다.
+ */
+void* concurrent_push(void* arg) {
+  shared_state* state = static_cast<shared_state*>(arg);
+  for (size_t i = 0; i < state->per_thread; ++i) {
+    state->concurrent.push_back(static_cast<long>(i));
+  }
+  return NULL;
+}
+
+/**
+ * @brief 각 thread 가 자기 vector 를 채운 뒤 mutex 를 잡고 합친다.
+ * (지금 ingest thread 들이 쓰는 방식)
+ */
+void* private_then_merge(void* arg) {
+  shared_state* state = static_cast<shared_state*>(arg);
+  ft::vector<long> local;
+  for (size_t i = 0; i < state->per_thread; ++i) {
+    local.push_back(static_cast<long>(i));
+  }
+  pthread_mutex_lock(&state->lock);
+  state->merged.insert(state->merged.end(), local.begin(), local.end());
+  pthread_mutex_unlock(&state->lock);
+  return NULL;
+}
+
+/**
+ * @brief push_back 마다 mutex 를 잡는다.
+ */
+void* locked_push(void* arg) {
+  shared_state* state = static_cast<shared_state*>(arg);
+  for (size_t i = 0; i < state->per_thread; ++i) {
+    pthread_mutex_lock(&state->lock);
+    state->merged.push_back(static_cast<long>(i));
+    pthread_mutex_unlock(&state->lock);
+  }
+  return NULL;
+}
+
+double run_threads(void* (*job)(void*), size_t threads) {
+  shared_state state;
+  state.per_thread = kItems / threads;
+  pthread_mutex_init(&state.lock, NULL);
+  pthread_t workers[64];
+  bench_timer timer;
+  for (size_t i = 0; i < threads; ++i) {
+    pthread_create(&workers[i], NULL, job, &state);
+  }
+  for (size_t i = 0; i < threads; ++i) {
+    pthread_join(workers[i], NULL);
+  }
+  const double ms = timer.elapsed_ms();
+  pthread_mutex_destroy(&state.lock);
+  bench_consume(state.concurrent.size() + state.merged.size());
+  return ms;
+}
+
+}  // namespace
+
+/**
+ * @brief 16M 개의 long 을 1 ~ N 개의 thread 로 나눠 한 container 에 모은다.
+ * N 은 core 수이고 FT_BENCH_THREADS 로 바꿀 수 있다. (최대 64)
+ */
+void concurrent_bench(void) {
+  const char* threads_env = std::getenv("FT_BENCH_THREADS");
+  const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t max_threads = cores > 1 ? static_cast<size_t>(cores) : 1;
+  if (threads_env) {
+    max_threads = std::strtoul(threads_env, NULL, 10);
+  }
+  max_threads = ft::min(ft::max(max_threads, static_cast<size_t>(1)),
+                        static_cast<size_t>(64));
+
+  bench_title("concurrent append (16M longs)");
+  for (size_t threads = 1;; threads = ft::min(threads * 2, max_threads)) {
+    std::ostringstream label;
+    label << threads << (threads == 1 ? " thread " : " threads ");
+    bench_report(label.str() + "concurrent_vector",
+                 run_threads(concurrent_push, threads));
+    bench_report(label.str() + "private vector + merge",
+                 run_threads(private_then_merge, threads));
+    bench_report(label.str() + "locked vector",
+                 run_threads(locked_push, threads));
+    if (threads == max_threads) {
+      break;
+    }
+  }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file cow_bench.cpp
+ * @author jiskim
+ * @brief passing a read-mostly vector by value: deep copy vs cow_vector
+ * @date 2023-02-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <string>
+
+#include "bench.hpp"
+#include "cow_vector.hpp"
+#include "stack.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kElements = 100 * 1000;
+const size_t kHandOffs = 200;
+const size_t kLayers = 4;
+
+/**
+ * @brief 값으로 받은 vector 를 다음 layer 로 다시 값으로 넘기고, 맨 아래
+ * layer 에서 읽기만 한다.
+ */
+template <typename Vector>
+long pass_down(Vector v, size_t layer) {
+  if (layer != 0) {
+    return pass_down(v, layer - 1);
+  }
+  const Vector& view = v;
+  return static_cast<long>(view.size() + view[view.size() / 2].size());
+}
+
+template <typename Vector>
+double read_only_copies(void) {
+  Vector v(kElements, std::string("read-mostly payload"));
+  bench_timer timer;
+  long sum = 0;
+  for (size_t i = 0; i < kHandOffs; ++i) {
+    sum += pass_down(v, kLayers);
+  }
+  bench_consume(sum);
+  return timer.elapsed_ms();
+}
+
+/**
+ * @brief 매번 복사본을 한 번 수정한다. cow_vector 도 결국 한 번 복사한다.
+ */
+template <typename Vector>
+double modified_copies(void) {
+  Vector v(kElements, std::string("read-mostly payload"));
+  bench_timer timer;
+  long sum = 0;
+  for (size_t i = 0; i < kHandOffs / 10; ++i) {
+    Vector copy(v);
+    copy.push_back("tail");
+    sum += static_cast<long>(copy.size());
+  }
+  bench_consume(sum);
+  return timer.elapsed_ms();
+}
+
+template <typename Container>
+double stack_snapshots(void) {
+  ft::stack<int, Container> s;
+  for (size_t i = 0; i < kElements * 10; ++i) {
+    s.push(static_cast<int>(i));
+  }
+  bench_timer timer;
+  long sum = 0;
+  for (size_t i = 0; i < kHandOffs; ++i) {
+    const ft::stack<int, Container> snapshot(s);
+    sum += snapshot.top();
+  }
+  bench_consume(sum);
+  return timer.elapsed_ms();
+}
+
+}  // namespace
+
+void cow_bench(void) {
+  typedef ft::vector<std::string> deep;
+  typedef ft::cow_vector<std::string> cow;
+
+  bench_title("100K strings passed by value through 4 layers");
+  bench_report("ft::vector (deep copy)", read_only_copies<deep>());
+  bench_report("ft::cow_vector", read_only_copies<cow>());
+
+  bench_title("copy, then modify once");
+  bench_report("ft::vector (deep copy)", modified_copies<deep>());
+  bench_report("ft::cow_vector", modified_copies<cow>());
+
+  bench_title("copying a 1M element stack");
+  bench_report("ft::stack<int, ft::vector<int> >",
+               stack_snapshots<ft::vector<int> >());
+  bench_report("ft::stack<int, ft::cow_vector<int> >",
+               stack_snapshots<ft::cow_vector<int> >());
+}
@@ -0,0 +1,71 @@
+/**
+ * @file deque_bench.cpp
+ * @author jiskim
+ * @brief stack of 4KB buffers, vector vs deque as the container
+ * @date 2023-02-21
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <deque>
+
+#include "bench.hpp"
+#include "deque.hpp"
+#include "stack.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kBuffers = 128 * 1024;  // 512MB
+
+struct Buffer {
+  int idx;
+  char buff[4096];
+};
+
+/**
+ * @brief kBuffers 개를 push 한 뒤 모두 pop 한다.
+ * push 한 번의 최대 시간도 같이 잰다. vector 는 재할당 때 모든 Buffer 를
+ * 복사하고, deque 는 block 하나만 새로 할당한다.
+ */
+template <typename Stack>
+void push_pop_buffers(const std::string& name) {
+  Stack stack;
+  Buffer buffer = Buffer();
+  long worst = 0;
+  bench_timer timer;
+  for (size_t i = 0; i < kBuffers; ++i) {
+    buffer.idx = static_cast<int>(i);
+    const long start = bench_now_ns();
+    stack.push(buffer);
+    worst = std::max(worst, bench_now_ns() - start);
+  }
+  const double push_ms = timer.elapsed_ms();
+  long sum = 0;
+  timer.reset();
+  while (!stack.empty()) {
+    sum += stack.top().idx;
+    stack.pop();
+  }
+  const double pop_ms = timer.elapsed_ms();
+  bench_report(name + " push", push_ms);
+  bench_report(name + " pop", pop_ms);
+  std::cout << "  worst push : " << worst / 1000 << "us\n";
+  bench_consume(sum);
+}
+
+}  // namespace
+
+/**
+ * @brief 4KB Buffer 128K 개를 vector, deque 를 container 로 하는 stack 에
+ * 넣고 뺀다.
+ */
+void deque_bench(void) {
+  bench_title("stack<Buffer> push/pop (128K x 4KB)");
+  push_pop_buffers<ft::stack<Buffer, ft::vector<Buffer> > >(
+      "stack<Buffer, ft::vector>");
+  push_pop_buffers<ft::stack<Buffer, ft::deque<Buffer> > >(
+      "stack<Buffer, ft::deque>");
+  push_pop_buffers<ft::stack<Buffer, std::deque<Buffer> > >(
+      "stack<Buffer, std::deque>");
+}
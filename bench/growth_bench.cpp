@@ -0,0 +1,83 @@
+/**
+ * @file growth_bench.cpp
+ * @author jiskim
+ * @brief compare growth policies of ft::vector
+ * @date 2023-02-10
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+namespace {
+
+struct Sample {
+  long key;
+  long value;
+  int flags;
+};
+
+const size_t kCount = 2 * 1024 * 1024;
+
+/**
+ * @brief push_back 만으로 kCount 개를 채우면서 재할당 횟수와 재할당 시 복사한
+ * byte 수를 센다. peak RSS 를 따로 재기 위해 자식 프로세스에서 실행한다.
+ */
+template <typename Policy>
+void run_policy(const std::string& name) {
+  std::cout.flush();
+  pid_t pid = fork();
+  if (pid < 0) {
+    std::cerr << "fork failed\n";
+    return;
+  }
+  if (pid > 0) {
+    waitpid(pid, NULL, 0);
+    return;
+  }
+
+  ft::vector<Sample, std::allocator<Sample>, Policy> v;
+  Sample sample = Sample();
+  size_t reallocs = 0;
+  size_t bytes_copied = 0;
+  bench_timer timer;
+  for (size_t i = 0; i < kCount; ++i) {
+    if (v.size() == v.capacity()) {
+      ++reallocs;
+      bytes_copied += v.size() * sizeof(Sample);
+    }
+    sample.key = i;
+    v.push_back(sample);
+  }
+  double ms = timer.elapsed_ms();
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  std::cout << std::left << std::setw(22) << name << std::right
+            << std::setw(10) << reallocs << std::setw(14)
+            << bytes_copied / (1024 * 1024) << std::setw(12)
+            << v.capacity() - v.size() << std::setw(12)
+            << usage.ru_maxrss / 1024 << std::setw(12) << std::fixed
+            << std::setprecision(3) << ms << '\n';
+  std::cout.flush();
+  _exit(0);
+}
+
+}  // namespace
+
+void growth_bench(void) {
+  bench_title("growth policy (push_back 2M x 24 bytes)");
+  std::cout << std::left << std::setw(22) << "policy" << std::right
+            << std::setw(10) << "reallocs" << std::setw(14) << "copied(MB)"
+            << std::setw(12) << "slack" << std::setw(12) << "peakRSS(MB)"
+            << std::setw(12) << "ms" << '\n';
+  run_policy<ft::growth_double>("growth_double");
+  run_policy<ft::growth_one_half>("growth_one_half");
+  run_policy<ft::growth_page_rounded>("growth_page_rounded");
+  run_policy<ft::growth_fixed<64 * 1024> >("growth_fixed<64K>");
+}
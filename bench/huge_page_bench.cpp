@@ -0,0 +1,91 @@
+/**
+ * @file huge_page_bench.cpp
+ * @author jiskim
+ * @brief std::allocator vs huge_page_allocator on GB sized vectors
+ * @date 2023-02-15
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <cstdlib>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kGB = 1024UL * 1024 * 1024;
+const size_t kRandomReads = 20 * 1000 * 1000;
+
+template <typename Vector>
+void access_bench(const std::string& name, size_t bytes) {
+  const size_t count = bytes / sizeof(long);
+  Vector v;
+  bench_timer timer;
+  v.reserve(count);
+  v.resize(count);
+  bench_report(name + " fill", timer.elapsed_ms());
+
+  timer.reset();
+  long sum = 0;
+  for (size_t i = 0; i < count; ++i) {
+    sum += v[i];
+  }
+  bench_report(name + " sequential read", timer.elapsed_ms());
+
+  timer.reset();
+  size_t idx = 1;
+  for (size_t i = 0; i < kRandomReads; ++i) {
+    idx = idx * 6364136223846793005UL + 1442695040888963407UL;
+    sum += v[(idx >> 16) % count];
+  }
+  bench_report(name + " random read (20M)", timer.elapsed_ms());
+  bench_consume(sum);
+}
+
+/**
+ * @brief vector<long>(count) 처럼 0 으로 value initialization 하는 비용.
+ * allocate_zeroed 를 제공하는 allocator 는 page 를 만질 때까지 비용이 없다.
+ */
+template <typename Vector>
+void zero_init_bench(const std::string& name, size_t bytes) {
+  const size_t count = bytes / sizeof(long);
+  bench_timer timer;
+  Vector v(count);
+  bench_report(name + " vector(n)", timer.elapsed_ms());
+  bench_consume(v[count / 2]);
+}
+
+}  // namespace
+
+/**
+ * @brief 1GB, 4GB 크기의 vector<long> 을 채우고 순차 / 임의 접근 시간을
+ * 잰다. 0 으로 채운 1GB vector 의 생성 비용도 비교한다.
+ * 메모리가 부족한 환경에서는 FT_BENCH_MAX_GB 로 상한을 줄인다.
+ */
+void huge_page_bench(void) {
+  const char* max_env = std::getenv("FT_BENCH_MAX_GB");
+  const size_t max_gb = max_env ? std::strtoul(max_env, NULL, 10) : 4;
+  const size_t sizes[] = {1, 4};
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+    if (sizes[i] > max_gb) {
+      continue;
+    }
+    std::ostringstream title;
+    title << "huge page storage (" << sizes[i] << "GB vector<long>)";
+    bench_title(title.str());
+    access_bench<ft::vector<long> >("std::allocator", sizes[i] * kGB);
+    access_bench<ft::vector<long, ft::huge_page_allocator<long> > >(
+        "huge_page_allocator", sizes[i] * kGB);
+  }
+
+  if (max_gb >= 1) {
+    bench_title("zero initialized 1GB vector<long>");
+    zero_init_bench<ft::vector<long> >("std::allocator", kGB);
+    zero_init_bench<ft::vector<long, ft::realloc_allocator<long> > >(
+        "realloc_allocator", kGB);
+    zero_init_bench<ft::vector<long, ft::huge_page_allocator<long> > >(
+        "huge_page_allocator", kGB);
+  }
+}
@@ -0,0 +1,125 @@
+/**
+ * @file io_bench.cpp
+ * @author jiskim
+ * @brief reading / writing large local files through ft::vector<char>
+ * @date 2023-02-24
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kFileBytes = 256UL * 1024 * 1024;
+const size_t kChunk = 64 * 1024;
+
+/**
+ * @brief 지금 방식. stack buffer 로 read 한 뒤 끝에 insert 한다.
+ * 모든 byte 가 kernel -> stack -> vector 로 두 번 복사된다.
+ */
+double read_via_stack_buffer(const char* path) {
+  ft::vector<char> data;
+  char buf[kChunk];
+  bench_timer timer;
+  const int fd = open(path, O_RDONLY);
+  ssize_t n;
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+    data.insert(data.end(), buf, buf + n);
+  }
+  close(fd);
+  double ms = timer.elapsed_ms();
+  bench_consume(data.size());
+  return ms;
+}
+
+/**
+ * @brief spare capacity 로 바로 read 한다. sized 이면 fstat 으로 얻은 크기만큼
+ * 먼저 reserve 해서 재할당도 없앤다.
+ */
+double read_via_append(const char* path, size_t chunk, bool sized) {
+  ft::vector<char> data;
+  bench_timer timer;
+  const int fd = open(path, O_RDONLY);
+  struct stat st;
+  if (sized && fstat(fd, &st) == 0) {
+    data.reserve(st.st_size + 1);  // +1 : EOF 를 확인하는 마지막 read
+  }
+  while (data.append_from_fd(fd, chunk) > 0) {
+  }
+  close(fd);
+  double ms = timer.elapsed_ms();
+  bench_consume(data.size());
+  return ms;
+}
+
+/**
+ * @brief message 들을 하나씩 write 하거나 writev 로 모아서 쓴다.
+ */
+double write_messages(const char* path, size_t message_bytes, bool gather) {
+  ft::vector<ft::vector<char> > messages(kFileBytes / message_bytes);
+  for (size_t i = 0; i < messages.size(); ++i) {
+    messages[i].resize(message_bytes);
+    std::memset(messages[i].data(), static_cast<int>(i), message_bytes);
+  }
+  // 이전 내용을 버리는 비용은 재지 않는다.
+  const int fd = open(path, O_WRONLY | O_TRUNC);
+  bench_timer timer;
+  if (gather) {
+    ft::write_to_fd(fd, messages.begin(), messages.end());
+  } else {
+    for (size_t i = 0; i < messages.size(); ++i) {
+      messages[i].write_to_fd(fd);
+    }
+  }
+  double ms = timer.elapsed_ms();
+  close(fd);
+  return ms;
+}
+
+}  // namespace
+
+/**
+ * @brief 256MB file 을 읽고 쓴다. file 은 FT_BENCH_DIR (기본 /tmp) 에 만들고
+ * 끝나면 지운다. 처음 쓴 뒤에는 page cache 에 있으므로 disk 가 아니라
+ * 복사 비용을 잰다.
+ */
+void io_bench(void) {
+  const char* dir = std::getenv("FT_BENCH_DIR");
+  std::string path = std::string(dir ? dir : "/tmp") + "/ft_io_benchXXXXXX";
+  const int fd = mkstemp(&path[0]);
+  if (fd < 0) {
+    std::cout << "io_bench : cannot create " << path << '\n';
+    return;
+  }
+  close(fd);
+
+  bench_title("write 256MB as 64KB / 256B messages");
+  bench_report("64KB write per message",
+               write_messages(path.c_str(), kChunk, false));
+  bench_report("64KB write_to_fd (writev)",
+               write_messages(path.c_str(), kChunk, true));
+  bench_report("256B write per message",
+               write_messages(path.c_str(), 256, false));
+  bench_report("256B write_to_fd (writev)",
+               write_messages(path.c_str(), 256, true));
+
+  bench_title("read 256MB file into ft::vector<char>");
+  bench_report("64KB stack buffer + insert",
+               read_via_stack_buffer(path.c_str()));
+  bench_report("append_from_fd 64KB",
+               read_via_append(path.c_str(), kChunk, false));
+  bench_report("append_from_fd 1MB",
+               read_via_append(path.c_str(), 1024 * 1024, false));
+  bench_report("reserve(file size) + append_from_fd 1MB",
+               read_via_append(path.c_str(), 1024 * 1024, true));
+  unlink(path.c_str());
+}
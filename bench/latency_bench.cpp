@@ -0,0 +1,108 @@
+/**
+ * @file latency_bench.cpp
+ * @author jiskim
+ * @brief push_back latency histogram, vector vs incremental_vector
+ * @date 2023-02-17
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "bench.hpp"
+#include "incremental_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kPushes = 32 * 1000 * 1000;
+
+struct Record {
+  long id;
+  double score;
+  char tag[16];
+};
+
+/**
+ * @brief push_back 한 번의 시간을 10 배 단위 bucket 으로 센다.
+ */
+class latency_histogram {
+ private:
+  static const int kBuckets = 8;  // <100ns, <1us, ..., <1s, >=1s
+  size_t _count[kBuckets];
+  std::vector<long> _samples;  // p99.9 계산용 상위 표본
+
+ public:
+  latency_histogram(void) : _samples() {
+    std::fill(_count, _count + kBuckets, 0);
+  }
+
+  void add(long ns) {
+    long limit = 100;
+    int idx = 0;
+    while (idx < kBuckets - 1 && ns >= limit) {
+      limit *= 10;
+      ++idx;
+    }
+    ++_count[idx];
+    if (ns >= 1000) {
+      _samples.push_back(ns);
+    }
+  }
+
+  void report(const std::string& name, size_t total, double total_ms) {
+    static const char* labels[kBuckets] = {"<100ns", "<1us",  "<10us", "<100us",
+                                           "<1ms",   "<10ms", "<1s",   ">=1s"};
+    bench_report(name + " total", total_ms);
+    std::cout << "  ";
+    for (int i = 0; i < kBuckets; ++i) {
+      std::cout << labels[i] << ":" << _count[i] << " ";
+    }
+    std::sort(_samples.begin(), _samples.end());
+    // 1000ns 미만인 표본은 버렸으므로 상위 0.1% 가 표본 안에 있을 때만 정확하다.
+    const size_t tail = total / 1000;
+    long p999 = 0;
+    if (tail != 0 && _samples.size() >= tail) {
+      p999 = _samples[_samples.size() - tail];
+    }
+    std::cout << "\n  p99.9 : ";
+    if (p999 == 0) {
+      std::cout << "<1000";
+    } else {
+      std::cout << p999;
+    }
+    std::cout << "ns, max : " << (_samples.empty() ? 0 : _samples.back())
+              << "ns\n";
+  }
+};
+
+template <typename Vector>
+void push_latency(const std::string& name) {
+  Vector v;
+  typename Vector::value_type val = typename Vector::value_type();
+  latency_histogram histogram;
+  bench_timer timer;
+  for (size_t i = 0; i < kPushes; ++i) {
+    const long start = bench_now_ns();
+    v.push_back(val);
+    histogram.add(bench_now_ns() - start);
+  }
+  histogram.report(name, kPushes, timer.elapsed_ms());
+  bench_consume(v.size());
+}
+
+}  // namespace
+
+/**
+ * @brief 32M 번 push_back 하면서 한 번씩의 시간을 잰다.
+ * vector 는 재할당할 때 전체를 복사하므로 꼬리 지연이 수 ms 까지 늘어난다.
+ */
+void latency_bench(void) {
+  bench_title("push_back latency (32M pushes)");
+  push_latency<ft::vector<int> >("ft::vector<int>");
+  push_latency<ft::incremental_vector<int> >("ft::incremental_vector<int>");
+  push_latency<ft::vector<Record> >("ft::vector<Record>");
+  push_latency<ft::incremental_vector<Record> >(
+      "ft::incremental_vector<Record>");
+}
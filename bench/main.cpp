@@ -0,0 +1,17 @@
+#include "bench.hpp"
+
+int main(void) {
+  vector_bench();
+  growth_bench();
+  huge_page_bench();
+  parallel_bench();
+  latency_bench();
+  deque_bench();
+  concurrent_bench();
+  io_bench();
+  mapped_bench();
+  cow_bench();
+  soa_bench();
+  packed_bench();
+  return 0;
+}
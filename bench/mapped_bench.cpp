@@ -0,0 +1,85 @@
+/**
+ * @file mapped_bench.cpp
+ * @author jiskim
+ * @brief rebuilding a lookup table vs reopening a mapped_vector
+ * @date 2023-02-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <unistd.h>
+
+#include <cstdlib>
+
+#include "bench.hpp"
+#include "mapped_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kEntries = 64UL * 1024 * 1024;  // 512MB of long
+const size_t kLookups = 1000 * 1000;
+
+// table 의 한 칸을 계산하는 비용 (재시작할 때마다 다시 만드는 부분)
+long table_entry(size_t i) {
+  unsigned long x = i * 0x9E3779B97F4A7C15UL;
+  x ^= x >> 29;
+  return static_cast<long>(x * 0xBF58476D1CE4E5B9UL);
+}
+
+template <typename Table>
+long random_lookups(const Table& table) {
+  long sum = 0;
+  size_t idx = 1;
+  for (size_t i = 0; i < kLookups; ++i) {
+    idx = idx * 6364136223846793005UL + 1442695040888963407UL;
+    sum += table[(idx >> 16) % table.size()];
+  }
+  return sum;
+}
+
+}  // namespace
+
+/**
+ * @brief 512MB lookup table 을 재시작할 때 다시 만드는 것과 mapped_vector
+ * 로 다시 여는 것을 비교한다. file 은 FT_BENCH_DIR (기본 /tmp) 에 만들고
+ * 끝나면 지운다.
+ */
+void mapped_bench(void) {
+  const char* dir = std::getenv("FT_BENCH_DIR");
+  const std::string path =
+      std::string(dir ? dir : "/tmp") + "/ft_mapped_bench.map";
+  unlink(path.c_str());
+
+  bench_title("512MB lookup table");
+  bench_timer timer;
+  {
+    ft::vector<long> table;
+    table.reserve(kEntries);
+    for (size_t i = 0; i < kEntries; ++i) {
+      table.push_back(table_entry(i));
+    }
+    bench_consume(random_lookups(table));
+  }
+  bench_report("restart: rebuild ft::vector + 1M lookups", timer.elapsed_ms());
+
+  timer.reset();
+  {
+    ft::mapped_vector<long> table(path.c_str());
+    table.reserve(kEntries);
+    for (size_t i = 0; i < kEntries; ++i) {
+      table.push_back(table_entry(i));
+    }
+  }
+  bench_report("first run: build mapped_vector", timer.elapsed_ms());
+
+  timer.reset();
+  {
+    ft::mapped_vector<long> table(path.c_str());
+    bench_report("restart: reopen mapped_vector", timer.elapsed_ms());
+    bench_consume(random_lookups(table));
+  }
+  bench_report("restart: reopen mapped_vector + 1M lookups",
+               timer.elapsed_ms());
+  unlink(path.c_str());
+}
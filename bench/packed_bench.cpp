@@ -0,0 +1,119 @@
+/**
+ * @file packed_bench.cpp
+ * @author jiskim
+ * @brief memory and scan speed of small integers: ft::vector vs packed_vector
+ * @date 2023-02-28
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <cstdlib>
+#include <sstream>
+
+#include "bench.hpp"
+#include "packed_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kValues = 16 * 1024 * 1024;
+const size_t kScans = 5;
+const size_t kChunk = 1024;
+
+std::string megabytes(const std::string& label, size_t bytes) {
+  std::ostringstream os;
+  os << label << " (" << bytes / (1024 * 1024) << "MB)";
+  return os.str();
+}
+
+template <typename T>
+double scan_vector(const ft::vector<T>& v) {
+  bench_timer timer;
+  long sum = 0;
+  for (size_t s = 0; s < kScans; ++s) {
+    for (size_t i = 0; i < v.size(); ++i) {
+      sum += v[i];
+    }
+  }
+  bench_consume(sum);
+  return timer.elapsed_ms();
+}
+
+template <typename Packed>
+double scan_get(const Packed& v) {
+  bench_timer timer;
+  long sum = 0;
+  for (size_t s = 0; s < kScans; ++s) {
+    for (size_t i = 0; i < v.size(); ++i) {
+      sum += v[i];
+    }
+  }
+  bench_consume(sum);
+  return timer.elapsed_ms();
+}
+
+// kChunk 개씩 decode 해서 읽는다.
+template <typename Packed>
+double scan_decode(const Packed& v) {
+  typename Packed::value_type buf[kChunk];
+  bench_timer timer;
+  long sum = 0;
+  for (size_t s = 0; s < kScans; ++s) {
+    for (size_t i = 0; i < v.size(); i += kChunk) {
+      const size_t n = ft::min(kChunk, v.size() - i);
+      v.decode(i, n, buf);
+      for (size_t j = 0; j < n; ++j) {
+        sum += buf[j];
+      }
+    }
+  }
+  bench_consume(sum);
+  return timer.elapsed_ms();
+}
+
+template <typename Packed>
+void report_packed(const std::string& label, const Packed& v) {
+  bench_report(megabytes(label + " get", v.memory_usage()), scan_get(v));
+  bench_report(label + " decode", scan_decode(v));
+}
+
+}  // namespace
+
+void packed_bench(void) {
+  srand(42);
+  bench_title("16M ints in [0, 4096), 5 scans");
+  {
+    ft::vector<int> v;
+    v.reserve(kValues);
+    for (size_t i = 0; i < kValues; ++i) {
+      v.push_back(rand() % 4096);
+    }
+    bench_report(megabytes("ft::vector<int>", v.capacity() * sizeof(int)),
+                 scan_vector(v));
+    bench_timer timer;
+    ft::packed_vector<int> packed;
+    packed.append(v.begin(), v.end());
+    bench_report("packed_fixed bulk append", timer.elapsed_ms());
+    report_packed("packed_fixed", packed);
+  }
+
+  bench_title("16M ms timestamps, 5 scans");
+  {
+    ft::vector<long> v;
+    v.reserve(kValues);
+    long t = 1677000000000L;
+    for (size_t i = 0; i < kValues; ++i) {
+      t += rand() % 200;
+      v.push_back(t);
+    }
+    bench_report(megabytes("ft::vector<long>", v.capacity() * sizeof(long)),
+                 scan_vector(v));
+    ft::packed_vector<long> fixed(v.begin(), v.end());
+    report_packed("packed_fixed", fixed);
+    bench_timer timer;
+    ft::packed_vector<long, ft::packed_blocks> blocks;
+    blocks.append(v.begin(), v.end());
+    bench_report("packed_blocks bulk append", timer.elapsed_ms());
+    report_packed("packed_blocks", blocks);
+  }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file parallel_bench.cpp
+ * @author jiskim
+ * @brief serial vs set_parallel_init on GB sized fill / copy
+ * @date 2023-02-16
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <unistd.h>
+
+#include <cstdlib>
+
+#include "bench.hpp"
+#include "parallel_pool.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kGB = 1024UL * 1024 * 1024;
+
+/**
+ * @brief fill constructor, copy constructor, assign(n, val) 의 시간을 잰다.
+ * 새로 할당한 page 를 처음 만지는 비용 (first touch) 이 대부분이다.
+ */
+void bulk_bench(const std::string& name, size_t bytes) {
+  const size_t count = bytes / sizeof(long);
+  bench_timer timer;
+  ft::vector<long> v(count, 42L);
+  bench_report(name + " fill constructor", timer.elapsed_ms());
+
+  timer.reset();
+  ft::vector<long> copy(v);
+  bench_report(name + " copy constructor", timer.elapsed_ms());
+
+  timer.reset();
+  copy.assign(count, 7L);
+  bench_report(name + " assign(n, val)", timer.elapsed_ms());
+  bench_consume(v[count / 2] + copy[count / 3]);
+}
+
+}  // namespace
+
+/**
+ * @brief 1GB vector<long> 을 한 thread 로 초기화할 때와 core 수 만큼 나눌 때를
+ * 비교한다. FT_BENCH_MAX_GB=0 이면 건너뛴다.
+ */
+void parallel_bench(void) {
+  const char* max_env = std::getenv("FT_BENCH_MAX_GB");
+  if (max_env && std::strtoul(max_env, NULL, 10) < 1) {
+    return;
+  }
+  const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  const size_t threads = cores > 1 ? static_cast<size_t>(cores) : 1;
+
+  std::ostringstream title;
+  title << "parallel init (1GB vector<long>, " << threads << " threads)";
+  bench_title(title.str());
+  bulk_bench("serial", kGB);
+  ft::set_parallel_init(threads);
+  bulk_bench("parallel", kGB);
+  ft::set_parallel_init(1);
+}
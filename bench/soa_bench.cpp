@@ -0,0 +1,147 @@
+/**
+ * @file soa_bench.cpp
+ * @author jiskim
+ * @brief scanning one field of records: ft::vector vs ft::soa_vector
+ * @date 2023-02-27
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "bench.hpp"
+#include "soa_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+const size_t kBufferSize = 4096;  // srcs/main.cpp 의 Buffer 와 같은 크기
+const size_t kBuffers = 32 * 1024;
+const size_t kBufferScans = 200;
+
+const size_t kParticles = 4 * 1024 * 1024;
+const size_t kSteps = 20;
+
+struct buffer {
+  int idx;
+  char buff[kBufferSize];
+};
+
+struct payload {
+  char buff[kBufferSize];
+};
+
+struct particle {
+  float x, y, z;
+  float vx, vy, vz;
+  int id;
+  int flags;
+};
+
+/**
+ * @brief buffer 의 idx 만 읽는다. ft::vector 는 record 마다 4KB 를
+ * 건너뛴다.
+ */
+double scan_buffer_ids(void) {
+  ft::vector<buffer> v(kBuffers);
+  for (size_t i = 0; i < kBuffers; ++i) {
+    v[i].idx = static_cast<int>(i);
+  }
+  bench_timer timer;
+  long sum = 0;
+  for (size_t s = 0; s < kBufferScans; ++s) {
+    for (size_t i = 0; i < kBuffers; ++i) {
+      sum += v[i].idx;
+    }
+  }
+  bench_consume(sum);
+  return timer.elapsed_ms();
+}
+
+double scan_soa_buffer_ids(void) {
+  typedef ft::soa_vector<int, payload> buffers;
+  buffers v(kBuffers);
+  int* ids = v.data<0>();
+  for (size_t i = 0; i < kBuffers; ++i) {
+    ids[i] = static_cast<int>(i);
+  }
+  bench_timer timer;
+  long sum = 0;
+  for (size_t s = 0; s < kBufferScans; ++s) {
+    const int* p = v.data<0>();
+    for (size_t i = 0; i < kBuffers; ++i) {
+      sum += p[i];
+    }
+  }
+  bench_consume(sum);
+  return timer.elapsed_ms();
+}
+
+/**
+ * @brief x += vx 만 계산한다. 나머지 field 는 읽지 않는다.
+ */
+double step_particles(void) {
+  ft::vector<particle> v(kParticles);
+  for (size_t i = 0; i < kParticles; ++i) {
+    v[i].vx = static_cast<float>(i % 7);
+  }
+  bench_timer timer;
+  for (size_t s = 0; s < kSteps; ++s) {
+    for (size_t i = 0; i < kParticles; ++i) {
+      v[i].x += v[i].vx;
+    }
+  }
+  bench_consume(v[kParticles / 2].x);
+  return timer.elapsed_ms();
+}
+
+typedef ft::soa_vector<float, float, float, float, float, float, int, int>
+    particles;
+
+particles make_soa_particles(void) {
+  particles v(kParticles);
+  float* vx = v.data<3>();
+  for (size_t i = 0; i < kParticles; ++i) {
+    vx[i] = static_cast<float>(i % 7);
+  }
+  return v;
+}
+
+// column pointer 로 계산하면 compiler 가 vectorize 할 수 있다.
+double step_soa_particles(void) {
+  particles v = make_soa_particles();
+  bench_timer timer;
+  for (size_t s = 0; s < kSteps; ++s) {
+    float* x = v.data<0>();
+    const float* vx = v.data<3>();
+    for (size_t i = 0; i < kParticles; ++i) {
+      x[i] += vx[i];
+    }
+  }
+  bench_consume(v.data<0>()[kParticles / 2]);
+  return timer.elapsed_ms();
+}
+
+// proxy iterator 로 접근해도 읽는 column 은 같다.
+double step_soa_particles_proxy(void) {
+  particles v = make_soa_particles();
+  bench_timer timer;
+  for (size_t s = 0; s < kSteps; ++s) {
+    for (particles::iterator it = v.begin(); it != v.end(); ++it) {
+      (*it).get<0>() += (*it).get<3>();
+    }
+  }
+  bench_consume(v.data<0>()[kParticles / 2]);
+  return timer.elapsed_ms();
+}
+
+}  // namespace
+
+void soa_bench(void) {
+  bench_title("sum of Buffer::idx, 32K x 4KB records, 200 scans");
+  bench_report("ft::vector<buffer>", scan_buffer_ids());
+  bench_report("ft::soa_vector<int, payload>", scan_soa_buffer_ids());
+
+  bench_title("x += vx, 4M x 32B particles, 20 steps");
+  bench_report("ft::vector<particle>", step_particles());
+  bench_report("ft::soa_vector data<I>()", step_soa_particles());
+  bench_report("ft::soa_vector iterator", step_soa_particles_proxy());
+}
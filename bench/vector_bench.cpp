@@ -0,0 +1,403 @@
+/**
+ * @file vector_bench.cpp
+ * @author jiskim
+ * @brief ft::vector benchmark
+ * @date 2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <iterator>
+#include <vector>
+
+#include "bench.hpp"
+#include "small_vector.hpp"
+#include "vector.hpp"
+
+namespace {
+
+struct Record {
+  int id;
+  double score;
+  char tag[16];
+
+  bool operator==(const Record& rhs) const { return id == rhs.id; }
+};
+
+// Record 와 같은 layout 이지만 user-defined copy 때문에 element 단위 경로를
+// 탄다.
+struct SlowRecord {
+  int id;
+  double score;
+  char tag[16];
+
+  SlowRecord(void) : id(), score() { std::memset(tag, 0, sizeof(tag)); }
+  SlowRecord(const SlowRecord& src) : id(src.id), score(src.score) {
+    std::memcpy(tag, src.tag, sizeof(tag));
+  }
+  SlowRecord& operator=(const SlowRecord& rhs) {
+    id = rhs.id;
+    score = rhs.score;
+    std::memcpy(tag, rhs.tag, sizeof(tag));
+    return *this;
+  }
+};
+
+// srcs/main.cpp 의 Buffer 와 같은 크기
+struct Page {
+  int idx;
+  char buff[4096];
+};
+
+const size_t kBaseSize = 100000;
+const size_t kOps = 2000;
+
+template <typename Vector>
+double middle_insert(void) {
+  Vector v(kBaseSize);
+  typename Vector::value_type val = typename Vector::value_type();
+  v.reserve(kBaseSize + kOps);
+  bench_timer timer;
+  for (size_t i = 0; i < kOps; ++i) {
+    v.insert(v.begin() + v.size() / 2, val);
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(v.size());
+  return ms;
+}
+
+template <typename Vector>
+double middle_erase(void) {
+  Vector v(kBaseSize + kOps);
+  bench_timer timer;
+  for (size_t i = 0; i < kOps; ++i) {
+    v.erase(v.begin() + v.size() / 2);
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(v.size());
+  return ms;
+}
+
+template <typename Vector>
+double grow_by_push_back(void) {
+  Vector v;
+  typename Vector::value_type val = typename Vector::value_type();
+  bench_timer timer;
+  for (size_t i = 0; i < kBaseSize * 10; ++i) {
+    v.push_back(val);
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(v.size());
+  return ms;
+}
+
+template <typename T>
+void run_bitwise_bench(const std::string& name) {
+  bench_report("middle insert  ft::vector<" + name + ">",
+               middle_insert<ft::vector<T> >());
+  bench_report("middle insert std::vector<" + name + ">",
+               middle_insert<std::vector<T> >());
+  bench_report("middle erase   ft::vector<" + name + ">",
+               middle_erase<ft::vector<T> >());
+  bench_report("middle erase  std::vector<" + name + ">",
+               middle_erase<std::vector<T> >());
+  bench_report("push_back      ft::vector<" + name + ">",
+               grow_by_push_back<ft::vector<T> >());
+}
+
+template <typename Vector>
+double grow_pages(size_t bytes) {
+  Vector v;
+  typename Vector::value_type page;
+  page.idx = 0;
+  std::memset(page.buff, 0, sizeof(page.buff));
+  const size_t count = bytes / sizeof(page);
+  bench_timer timer;
+  for (size_t i = 0; i < count; ++i) {
+    v.push_back(page);
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(v.size());
+  return ms;
+}
+
+/**
+ * @brief 요청마다 만들고 버리는 짧은 vector
+ */
+template <typename Vector>
+double short_lived(void) {
+  long sum = 0;
+  bench_timer timer;
+  for (size_t i = 0; i < kBaseSize * 10; ++i) {
+    Vector v;
+    for (int j = 0; j < 12; ++j) {
+      v.push_back(j);
+    }
+    sum += v.back();
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(sum);
+  return ms;
+}
+
+/**
+ * @brief buffer 를 n byte 로 늘린 뒤 바로 덮어쓰는 packet 경로.
+ * resize 는 0 으로 한 번, 덮어쓰면서 또 한 번 메모리를 지나간다.
+ */
+double refill_buffer(bool default_init) {
+  const size_t kPacket = 64 * 1024;
+  ft::vector<char> buf;
+  buf.reserve(kPacket);
+  bench_timer timer;
+  for (size_t i = 0; i < kBaseSize; ++i) {
+    buf.clear();
+    if (default_init) {
+      buf.resize_default_init(kPacket);
+    } else {
+      buf.resize(kPacket);
+    }
+    std::memset(buf.data(), static_cast<int>(i), kPacket);
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(buf[0]);
+  return ms;
+}
+
+/**
+ * @brief 크기를 알고 reserve 한 batch 에 trailer 를 하나 더 붙인다.
+ * capacity 가 요청한 그대로면 trailer 마다 batch 전체를 재할당한다.
+ */
+template <typename Vector>
+double reserve_then_trailer(size_t n) {
+  const typename Vector::value_type line("header: value");
+  size_t total = 0;
+  bench_timer timer;
+  for (size_t batch = n; batch < n + 64 * 100; batch += 100) {
+    Vector v;
+    v.reserve(batch);
+    for (size_t i = 0; i <= batch; ++i) {  // batch 개 + trailer
+      v.push_back(line);
+    }
+    total += v.capacity();
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(total);
+  return ms;
+}
+
+/**
+ * @brief decoder 가 std::allocator 로 할당해서 채운 buffer 를 ft::vector 로
+ * 넘겨받는다. adopt 하지 않으면 range 생성자로 복사하고 원본을 해제한다.
+ */
+double hand_off_buffers(bool adopt) {
+  const size_t kBytes = 16 * 1024 * 1024;
+  std::allocator<char> alloc;
+  size_t total = 0;
+  bench_timer timer;
+  for (int i = 0; i < 64; ++i) {
+    char* decoded = alloc.allocate(kBytes);
+    std::memset(decoded, i, kBytes);
+    ft::vector<char> msg;
+    if (adopt) {
+      msg.adopt(decoded, kBytes, kBytes);
+    } else {
+      ft::vector<char>(decoded, decoded + kBytes).swap(msg);
+      alloc.deallocate(decoded, kBytes);
+    }
+    total += msg[i];
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(total);
+  return ms;
+}
+
+/**
+ * @brief istream_iterator 로 읽은 record 를 큰 vector 의 중간에 삽입한다.
+ * 길이를 모르는 single-pass range 경로.
+ */
+template <typename Vector>
+double stream_insert(const std::string& records) {
+  Vector v(kBaseSize * 10);
+  std::istringstream is(records);
+  bench_timer timer;
+  v.insert(v.begin() + v.size() / 2, std::istream_iterator<int>(is),
+           std::istream_iterator<int>());
+  double ms = timer.elapsed_ms();
+  bench_consume(v.size());
+  return ms;
+}
+
+// 3 개 중 하나가 만료된 session
+template <typename T>
+struct expired {
+  bool operator()(const T& r) const { return r.id % 3 == 0; }
+};
+
+template <typename Vector>
+void fill_sessions(Vector& v, size_t n) {
+  v.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    v[i].id = static_cast<int>(i);
+  }
+}
+
+/**
+ * @brief 만료된 session 을 erase(iterator) 로 하나씩 지운다. O(N^2)
+ */
+template <typename Vector>
+double purge_by_erase(size_t n) {
+  Vector v;
+  fill_sessions(v, n);
+  expired<typename Vector::value_type> pred;
+  bench_timer timer;
+  for (typename Vector::iterator it = v.begin(); it != v.end();) {
+    if (pred(*it)) {
+      it = v.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(v.size());
+  return ms;
+}
+
+template <typename Vector>
+double purge_by_erase_if(size_t n) {
+  Vector v;
+  fill_sessions(v, n);
+  bench_timer timer;
+  ft::erase_if(v, expired<typename Vector::value_type>());
+  double ms = timer.elapsed_ms();
+  bench_consume(v.size());
+  return ms;
+}
+
+const size_t kFlags = 1UL << 27;  // 128M flag
+
+/**
+ * @brief step 마다 하나씩 true 인 flag 배열.
+ */
+template <typename Vector>
+void set_flags(Vector& v, size_t step) {
+  for (size_t i = 0; i < v.size(); i += step) {
+    v[i] = true;
+  }
+}
+
+/**
+ * @brief element 를 하나씩 보면서 true 의 수를 센다.
+ * ft::vector<char> 는 특수화 전의 byte 하나에 flag 하나인 layout 이다.
+ */
+template <typename Vector>
+double count_flags(size_t step) {
+  Vector v(kFlags);
+  set_flags(v, step);
+  bench_timer timer;
+  size_t n = 0;
+  for (size_t i = 0; i < v.size(); ++i) {
+    n += v[i] ? 1 : 0;
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(n);
+  return ms;
+}
+
+double count_bits(size_t step) {
+  ft::vector<bool> v(kFlags);
+  set_flags(v, step);
+  bench_timer timer;
+  size_t n = v.count();
+  double ms = timer.elapsed_ms();
+  bench_consume(n);
+  return ms;
+}
+
+double scan_bits(size_t step) {
+  ft::vector<bool> v(kFlags);
+  set_flags(v, step);
+  bench_timer timer;
+  size_t n = 0;
+  for (size_t i = v.find_first(); i != v.npos; i = v.find_next(i)) {
+    ++n;
+  }
+  double ms = timer.elapsed_ms();
+  bench_consume(n);
+  return ms;
+}
+
+}  // namespace
+
+void vector_bench(void) {
+  bench_title("bitwise fast path (trivially copyable)");
+  run_bitwise_bench<int>("int");
+  run_bitwise_bench<Record>("Record");
+  bench_title("element-wise path (user-defined copy)");
+  run_bitwise_bench<SlowRecord>("SlowRecord");
+
+  bench_title("short-lived vectors of 12 elements");
+  bench_report("ft::vector<int>", short_lived<ft::vector<int> >());
+  bench_report("ft::small_vector<int, 16>",
+               short_lived<ft::small_vector<int, 16> >());
+
+  bench_title("stream 20000 records into the middle of 1M ints");
+  std::ostringstream records;
+  for (int i = 0; i < 20000; ++i) {
+    records << i << '\n';
+  }
+  bench_report("ft::vector<int>",
+               stream_insert<ft::vector<int> >(records.str()));
+  bench_report("std::vector<int>",
+               stream_insert<std::vector<int> >(records.str()));
+
+  bench_title("reserve 10000 ~ 16400 strings + 1 trailer x 64");
+  bench_report("std::allocator",
+               reserve_then_trailer<ft::vector<std::string> >(10000));
+  bench_report(
+      "realloc_allocator (usable size)",
+      reserve_then_trailer<
+          ft::vector<std::string, ft::realloc_allocator<std::string> > >(
+          10000));
+
+  bench_title("hand off 64 decoded 16MB buffers");
+  bench_report("range constructor (copy)", hand_off_buffers(false));
+  bench_report("adopt", hand_off_buffers(true));
+
+  bench_title("purge 1 in 3 expired sessions");
+  bench_report("100K Record erase() loop",
+               purge_by_erase<ft::vector<Record> >(kBaseSize));
+  bench_report("100K Record erase_if",
+               purge_by_erase_if<ft::vector<Record> >(kBaseSize));
+  bench_report("100K SlowRecord erase() loop",
+               purge_by_erase<ft::vector<SlowRecord> >(kBaseSize));
+  bench_report("100K SlowRecord erase_if",
+               purge_by_erase_if<ft::vector<SlowRecord> >(kBaseSize));
+  bench_report("1M Record erase_if",
+               purge_by_erase_if<ft::vector<Record> >(kBaseSize * 10));
+  bench_report("1M SlowRecord erase_if",
+               purge_by_erase_if<ft::vector<SlowRecord> >(kBaseSize * 10));
+
+  bench_title("128M flags, count (1 in 7 set)");
+  bench_report("ft::vector<char> (128MB) loop",
+               count_flags<ft::vector<char> >(7));
+  bench_report("std::vector<bool> (16MB) loop",
+               count_flags<std::vector<bool> >(7));
+  bench_report("ft::vector<bool> (16MB) count()", count_bits(7));
+
+  bench_title("128M flags, visit set flags (1 in 4096 set)");
+  bench_report("ft::vector<char> (128MB) loop",
+               count_flags<ft::vector<char> >(4096));
+  bench_report("ft::vector<bool> (16MB) find_next()", scan_bits(4096));
+
+  bench_title("64KB packet buffer refill x 100000");
+  bench_report("resize + overwrite", refill_buffer(false));
+  bench_report("resize_default_init + overwrite", refill_buffer(true));
+
+  bench_title("growth of 4KB elements up to 512MB");
+  bench_report("std::allocator",
+               grow_pages<ft::vector<Page> >(512UL * 1024 * 1024));
+  bench_report(
+      "realloc_allocator (mremap)",
+      grow_pages<ft::vector<Page, ft::realloc_allocator<Page> > >(512UL * 1024 *
+                                                                  1024));
+}
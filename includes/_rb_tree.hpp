@@ -13,6 +13,7 @@
 #include "algorithm.hpp"
 #include "pair.hpp"
 #include "reverse_iterator.hpp"
+#include "type_traits.hpp"
 
 namespace ft {
 
@@ -42,6 +43,25 @@ struct _rb_tree_node_base {
 };
 // !SECTION: rb tree node base
 
+// srcs/_rb_tree.cpp 에 정의되어 있다. template 안에서 쓰기 전에 선언한다.
+_rb_tree_node_base* _get_subtree_min(_rb_tree_node_base* x);
+const _rb_tree_node_base* _get_subtree_min(const _rb_tree_node_base* x);
+
+_rb_tree_node_base* _get_subtree_max(_rb_tree_node_base* x);
+const _rb_tree_node_base* _get_subtree_max(const _rb_tree_node_base* x);
+
+_rb_tree_node_base* _node_increment(_rb_tree_node_base* x);
+const _rb_tree_node_base* _node_increment(const _rb_tree_node_base* x);
+
+_rb_tree_node_base* _node_decrement(_rb_tree_node_base* x);
+const _rb_tree_node_base* _node_decrement(const _rb_tree_node_base* x);
+
+void _insert_rebalance(bool left, _rb_tree_node_base* x, _rb_tree_node_base* p,
+                       _rb_tree_node_base& header);
+
+_rb_tree_node_base* _rebalance_for_erase(_rb_tree_node_base* const z,
+                                         _rb_tree_node_base& header);
+
 // SECTION: rb tree node
 template <typename Val>
 struct _rb_tree_node : public _rb_tree_node_base {
@@ -317,6 +337,16 @@ class _rb_tree {
     }
   }
 
+#if FT_HAS_MOVE
+  // NOTHROW
+  // node 는 옮기지 않고 header 만 넘겨받는다. x 는 빈 tree 가 된다.
+  _rb_tree(_rb_tree&& x) noexcept : _impl(x._impl), _alloc(x._alloc) {
+    if (x._root() != NULL) {
+      _impl._move_data(x._impl);
+    }
+  }
+#endif
+
   ~_rb_tree(void) { _erase_all(_root()); }
 
   _rb_tree& operator=(const _rb_tree& x) {
@@ -330,6 +360,20 @@ class _rb_tree {
     return *this;
   }
 
+#if FT_HAS_MOVE
+  // NOTHROW
+  _rb_tree& operator=(_rb_tree&& x) noexcept {
+    if (this != &x) {
+      clear();
+      _impl._compare = x._impl._compare;
+      if (x._root() != NULL) {
+        _impl._move_data(x._impl);
+      }
+    }
+    return *this;
+  }
+#endif
+
   iterator begin(void) { return iterator(_impl._header.left); }
   const_iterator begin(void) const {
     return const_iterator(_impl._header.left);
@@ -410,8 +454,8 @@ class _rb_tree {
       _get_root()->parent = &_impl._header;
       x._get_root()->parent = &x._impl._header;
       ft::swap(_impl._node_count, x._impl._node_count);
-      ft::swap(_impl._compare, x._impl._compare);
     }
+    ft::swap(_impl._compare, x._impl._compare);
   }
 
   // NOTHROW
@@ -765,24 +809,6 @@ class _rb_tree {
 };
 // !SECTION: red-black tree
 
-_rb_tree_node_base* _get_subtree_min(_rb_tree_node_base* x);
-const _rb_tree_node_base* _get_subtree_min(const _rb_tree_node_base* x);
-
-_rb_tree_node_base* _get_subtree_max(_rb_tree_node_base* x);
-const _rb_tree_node_base* _get_subtree_max(const _rb_tree_node_base* x);
-
-_rb_tree_node_base* _node_increment(_rb_tree_node_base* x);
-const _rb_tree_node_base* _node_increment(const _rb_tree_node_base* x);
-
-_rb_tree_node_base* _node_decrement(_rb_tree_node_base* x);
-const _rb_tree_node_base* _node_decrement(const _rb_tree_node_base* x);
-
-void _insert_rebalance(bool left, _rb_tree_node_base* x, _rb_tree_node_base* p,
-                       _rb_tree_node_base& header);
-
-_rb_tree_node_base* _rebalance_for_erase(_rb_tree_node_base* const z,
-                                         _rb_tree_node_base& header);
-
 }  // namespace ft
 
 #endif  // _RB_TREE_HPP
@@ -0,0 +1,436 @@
+/**
+ * @file concurrent_vector.hpp
+ * @author jiskim
+ * @brief append-only vector with lock-free push_back from many threads
+ * @date 2023-02-22
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef CONCURRENT_VECTOR_HPP
+#define CONCURRENT_VECTOR_HPP
+
+#include <memory>     // std::allocator
+#include <new>        // placement new
+#include <stdexcept>  // out_of_range, length_error
+
+#include "incremental_vector.hpp"  // incremental_vector_iterator
+#include "reverse_iterator.hpp"
+#include "type_traits.hpp"
+
+#if !defined(__GNUC__)
+#error "ft::concurrent_vector needs the __atomic builtins (gcc, clang)"
+#endif
+
+namespace ft {
+
+// SECTION: atomic helpers
+template <typename T>
+inline T _atomic_load(const T* p) {
+  return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief *p 가 expected 이면 desired 로 바꾼다. 실패하면 expected 에 현재 값을
+ * 읽어온다.
+ */
+template <typename T>
+inline bool _atomic_cas(T* p, T& expected, T desired) {
+  return __atomic_compare_exchange_n(p, &expected, desired, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+inline size_t _floor_log2(size_t x) {
+  return sizeof(unsigned long) * 8 - 1 -
+         __builtin_clzl(static_cast<unsigned long>(x));
+}
+// !SECTION: atomic helpers
+
+// SECTION: concurrent_vector
+/**
+ * @brief 여러 thread 가 동시에 push_back, grow_by 할 수 있는 append-only
+ * vector.
+ *
+ * element 는 2배씩 커지는 segment 들에 나뉘어 있고 (16, 32, 64, ...),
+ * segment 의 pointer 는 고정 크기 table 에 있다. 한 번 놓인 element 는
+ * 옮겨지지 않으므로 reference 와 iterator 는 clear 전까지 유효하다.
+ *
+ * push_back 은 필요한 segment 를 CAS 로 설치한 뒤 size 를 CAS 로 늘려 자리를
+ * 얻는다 (lock-free). 자리를 얻기 전에 할당하므로 bad_alloc 은 아무 자리도
+ * 차지하지 않는다. operator[] 는 segment pointer 하나를 읽으므로 wait-free
+ * 이다.
+ *
+ * size() 에는 아직 생성 중인 element 가 포함될 수 있다. 다른 thread 가 넣은
+ * element 는 그 push_back 이 끝난 뒤에 (thread join, flag 등으로 동기화한
+ * 뒤에) 읽어야 한다.
+ *
+ * push_back, grow_by, reserve, 읽기 외의 함수 (clear, swap, operator= 등) 는
+ * 다른 thread 와 동시에 호출하면 안된다.
+ *
+ * @tparam T 생성 중 예외가 나면 그 자리는 value_type() 으로 채워지므로 기본
+ * 생성자는 예외를 던지면 안된다.
+ * @tparam Alloc
+ */
+template <typename T, typename Alloc = std::allocator<T> >
+class concurrent_vector {
+ public:
+  typedef T value_type;
+  typedef Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+
+  typedef incremental_vector_iterator<concurrent_vector, value_type> iterator;
+  typedef incremental_vector_iterator<const concurrent_vector,
+                                      const value_type>
+      const_iterator;
+
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+ private:
+  // 첫 segment 는 2^kFirstShift 개, segment k 는 2^(kFirstShift + k) 개.
+  static const size_type kFirstShift = 4;
+  static const size_type kSegments = sizeof(size_type) * 8 - kFirstShift;
+
+  allocator_type _alloc;
+  pointer _segments[kSegments];
+  size_type _size;
+
+ public:
+  // SECTION: constructor and destructor
+  // STRONG
+  explicit concurrent_vector(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _size(0) {
+    _init_segments();
+  }
+
+  explicit concurrent_vector(size_type n, const value_type& val = value_type(),
+                             const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _size(0) {
+    _init_segments();
+    try {
+      reserve(n);
+      for (; _size < n; ++_size) {
+        _alloc.construct(&(*this)[_size], val);
+      }
+    } catch (...) {
+      _release();
+      throw;
+    }
+  }
+
+  // x 에 다른 thread 가 push_back 하는 중이면 안된다.
+  concurrent_vector(const concurrent_vector& x) : _alloc(x._alloc), _size(0) {
+    _init_segments();
+    try {
+      reserve(x.size());
+      for (; _size < x.size(); ++_size) {
+        _alloc.construct(&(*this)[_size], x[_size]);
+      }
+    } catch (...) {
+      _release();
+      throw;
+    }
+  }
+
+#if FT_HAS_MOVE
+  concurrent_vector(concurrent_vector&& x) noexcept
+      : _alloc(x._alloc), _size(0) {
+    _init_segments();
+    swap(x);
+  }
+#endif
+
+  // NOTHROW
+  ~concurrent_vector(void) { _release(); }
+  // !SECTION: constructor and destructor
+
+  // STRONG
+  concurrent_vector& operator=(const concurrent_vector& x) {
+    if (this != &x) {
+      concurrent_vector tmp(x);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+#if FT_HAS_MOVE
+  // NOTHROW
+  concurrent_vector& operator=(concurrent_vector&& x) noexcept {
+    concurrent_vector tmp(std::move(x));
+    swap(tmp);
+    return *this;
+  }
+#endif
+
+  // SECTION: iterator
+  iterator begin(void) { return iterator(this, 0); }
+  const_iterator begin(void) const { return const_iterator(this, 0); }
+
+  iterator end(void) { return iterator(this, size()); }
+  const_iterator end(void) const { return const_iterator(this, size()); }
+
+  reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin(void) const {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend(void) { return reverse_iterator(begin()); }
+  const_reverse_iterator rend(void) const {
+    return const_reverse_iterator(begin());
+  }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return _atomic_load(&_size); }
+
+  size_type max_size(void) const { return _alloc.max_size(); }
+
+  /**
+   * @brief 앞에서부터 이어서 할당된 segment 들에 들어가는 element 의 수.
+   */
+  size_type capacity(void) const {
+    size_type k = 0;
+    while (k < kSegments && _atomic_load(&_segments[k]) != NULL) {
+      ++k;
+    }
+    return _segment_base(k);
+  }
+
+  bool empty(void) const { return size() == 0; }
+
+  // STRONG
+  // 다른 thread 의 push_back 과 동시에 호출해도 된다.
+  void reserve(size_type n) {
+    if (n > max_size()) {
+      throw std::length_error("ft::concurrent_vector::reserve");
+    }
+    _allocate_segments(0, n);
+  }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  // NOTHROW size > n
+  // otherwise UB
+  /**
+   * @brief n 번째 element. segment 를 찾는 shift 몇 번과 pointer 하나를
+   * 읽는 것이 전부라 wait-free 이다.
+   * @complexity O(1)
+   */
+  reference operator[](size_type n) {
+    const size_type k = _segment_index(n);
+    return _atomic_load(&_segments[k])[n - _segment_base(k)];
+  }
+  const_reference operator[](size_type n) const {
+    const size_type k = _segment_index(n);
+    return _atomic_load(&_segments[k])[n - _segment_base(k)];
+  }
+
+  // STRONG
+  reference at(size_type n) {
+    if (n >= size()) {
+      throw std::out_of_range("ft::concurrent_vector::at n is out of range.");
+    }
+    return (*this)[n];
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("ft::concurrent_vector::at n is out of range.");
+    }
+    return (*this)[n];
+  }
+
+  // NOTHROW container is not empty
+  // otherwise UB
+  reference front(void) { return (*this)[0]; }
+  const_reference front(void) const { return (*this)[0]; }
+
+  reference back(void) { return (*this)[size() - 1]; }
+  const_reference back(void) const { return (*this)[size() - 1]; }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // BASIC
+  /**
+   * @brief 끝에 val 을 추가한다. 여러 thread 에서 동시에 호출해도 된다.
+   *
+   * @return iterator 추가한 element 를 가리킨다. 동시에 추가된 다른 element
+   * 때문에 end() - 1 이 아닐 수 있다.
+   * @complexity O(1) (segment 할당은 amortized)
+   */
+  iterator push_back(const value_type& val) {
+    const size_type index = _claim(1);
+    _construct_range(index, index + 1, val);
+    return iterator(this, index);
+  }
+
+  // BASIC
+  /**
+   * @brief 끝에 val 을 n 개 추가한다. n 개는 연속된 index 를 차지한다.
+   * 여러 thread 에서 동시에 호출해도 된다.
+   *
+   * @return iterator 추가한 첫 element
+   */
+  iterator grow_by(size_type n, const value_type& val = value_type()) {
+    const size_type index = _claim(n);
+    _construct_range(index, index + n, val);
+    return iterator(this, index);
+  }
+
+  // NOTHROW allocator in both vectors compare equal
+  // otherwise UB
+  void swap(concurrent_vector& x) {
+    for (size_type k = 0; k < kSegments; ++k) {
+      ft::swap(_segments[k], x._segments[k]);
+    }
+    ft::swap(_size, x._size);
+  }
+
+  // NOTHROW
+  /**
+   * @brief 모든 element 를 지운다. segment 는 다시 쓰기 위해 남겨둔다.
+   */
+  void clear(void) {
+    _destroy(0, _size);
+    _size = 0;
+  }
+  // !SECTION: modifiers
+
+  allocator_type get_allocator(void) const { return _alloc; }
+
+  // SECTION: private functions
+ private:
+  static size_type _segment_size(size_type k) {
+    return static_cast<size_type>(1) << (kFirstShift + k);
+  }
+
+  // segment k 의 첫 index. segment 0 ~ k-1 의 크기의 합이다.
+  static size_type _segment_base(size_type k) {
+    return _segment_size(k) - _segment_size(0);
+  }
+
+  static size_type _segment_index(size_type n) {
+    return _floor_log2((n >> kFirstShift) + 1);
+  }
+
+  void _init_segments(void) {
+    for (size_type k = 0; k < kSegments; ++k) {
+      _segments[k] = NULL;
+    }
+  }
+
+  /**
+   * @brief segment k 가 없으면 할당해서 설치한다. 다른 thread 가 먼저 설치했으면
+   * 할당한 것을 돌려준다.
+   */
+  void _allocate_segment(size_type k) {
+    if (_atomic_load(&_segments[k]) != NULL) {
+      return;
+    }
+    pointer segment = _alloc.allocate(_segment_size(k));
+    pointer expected = NULL;
+    if (!_atomic_cas(&_segments[k], expected, segment)) {
+      _alloc.deallocate(segment, _segment_size(k));
+    }
+  }
+
+  // [first, last) index 가 들어갈 segment 들을 할당한다.
+  void _allocate_segments(size_type first, size_type last) {
+    if (first == last) {
+      return;
+    }
+    const size_type k_last = _segment_index(last - 1);
+    for (size_type k = _segment_index(first); k <= k_last; ++k) {
+      _allocate_segment(k);
+    }
+  }
+
+  /**
+   * @brief n 개의 연속된 자리를 얻고 첫 index 를 돌려준다.
+   * segment 를 먼저 할당하고 size 를 CAS 로 늘리므로, 예외가 나면 자리를
+   * 얻지 않은 것이다.
+   */
+  size_type _claim(size_type n) {
+    size_type cur = _atomic_load(&_size);
+    for (;;) {
+      if (n > max_size() - cur) {
+        throw std::length_error("ft::concurrent_vector::grow_by");
+      }
+      _allocate_segments(cur, cur + n);
+      if (_atomic_cas(&_size, cur, cur + n)) {
+        return cur;
+      }
+    }
+  }
+
+  /**
+   * @brief 얻은 자리 [first, last) 에 val 을 생성한다. 자리는 돌려줄 수 없으므로
+   * 예외가 나면 남은 자리를 value_type() 으로 채우고 다시 던진다.
+   */
+  void _construct_range(size_type first, size_type last,
+                        const value_type& val) {
+    size_type i = first;
+    try {
+      for (; i < last; ++i) {
+        _alloc.construct(&(*this)[i], val);
+      }
+    } catch (...) {
+      // 복사를 거치지 않도록 기본 생성자를 직접 부른다.
+      for (; i < last; ++i) {
+        ::new (static_cast<void*>(&(*this)[i])) value_type();
+      }
+      throw;
+    }
+  }
+
+  void _destroy(size_type first, size_type last) {
+    if (is_trivially_destructible<value_type>::value) {
+      return;
+    }
+    for (; first < last; ++first) {
+      _alloc.destroy(&(*this)[first]);
+    }
+  }
+
+  void _release(void) {
+    _destroy(0, _size);
+    for (size_type k = 0; k < kSegments; ++k) {
+      if (_segments[k] != NULL) {
+        _alloc.deallocate(_segments[k], _segment_size(k));
+        _segments[k] = NULL;
+      }
+    }
+    _size = 0;
+  }
+  // !SECTION: private functions
+};
+
+// SECTION: non-member function of concurrent_vector
+template <typename T, typename Alloc>
+bool operator==(const concurrent_vector<T, Alloc>& lhs,
+                const concurrent_vector<T, Alloc>& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename Alloc>
+bool operator!=(const concurrent_vector<T, Alloc>& lhs,
+                const concurrent_vector<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, typename Alloc>
+void swap(concurrent_vector<T, Alloc>& x, concurrent_vector<T, Alloc>& y) {
+  x.swap(y);
+}
+// !SECTION: non-member function of concurrent_vector
+// !SECTION: concurrent_vector
+
+}  // namespace ft
+
+#endif  // CONCURRENT_VECTOR_HPP
@@ -0,0 +1,440 @@
+/**
+ * @file cow_vector.hpp
+ * @author jiskim
+ * @brief copy-on-write vector
+ * @date 2023-02-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef COW_VECTOR_HPP
+#define COW_VECTOR_HPP
+
+#include <memory>  // std::allocator
+#include <new>     // placement new
+
+#include "vector.hpp"
+
+#if !defined(__GNUC__)
+#error "cow_vector needs the GCC / clang __atomic builtins"
+#endif
+
+namespace ft {
+
+// SECTION: cow_vector
+/**
+ * @brief 복사하면 storage 를 reference count 로 공유하고, 처음 수정할 때
+ * 복사하는 vector. 값으로 여러 layer 를 거쳐 넘기는 read-mostly vector 의
+ * 복사가 O(1) 이 된다.
+ *
+ * 수정할 수 있는 reference, pointer, iterator 를 돌려주는 함수 (const 가
+ * 아닌 operator[], begin 등) 도 수정으로 보고 먼저 공유를 푼다. 읽기만
+ * 하려면 const 로 접근한다. 그런 reference 를 한 번 내준 storage 는 다른
+ * 객체가 그 reference 로 바뀌는 값을 보지 않도록 이후의 복사에서 공유하지
+ * 않는다. (clear, assign, operator= 로 다시 공유할 수 있게 된다.)
+ *
+ * 서로 다른 cow_vector 객체는 storage 를 공유하더라도 다른 thread 에서
+ * 복사, 소멸, 수정해도 된다. 한 객체를 동시에 수정하면 안 되는 것은
+ * vector 와 같다.
+ *
+ * @tparam T
+ * @tparam Alloc
+ */
+template <typename T, typename Alloc = std::allocator<T> >
+class cow_vector {
+ public:
+  typedef vector<T, Alloc> vector_type;
+  typedef typename vector_type::value_type value_type;
+  typedef typename vector_type::allocator_type allocator_type;
+  typedef typename vector_type::reference reference;
+  typedef typename vector_type::const_reference const_reference;
+  typedef typename vector_type::pointer pointer;
+  typedef typename vector_type::const_pointer const_pointer;
+
+  typedef typename vector_type::iterator iterator;
+  typedef typename vector_type::const_iterator const_iterator;
+  typedef typename vector_type::reverse_iterator reverse_iterator;
+  typedef typename vector_type::const_reverse_iterator const_reverse_iterator;
+  typedef typename vector_type::difference_type difference_type;
+  typedef typename vector_type::size_type size_type;
+
+ private:
+  struct _rep {
+    vector_type data;
+    size_type refs;
+    bool shareable;  // 수정 가능한 reference 를 내준 뒤에는 false
+
+    explicit _rep(const allocator_type& alloc)
+        : data(alloc), refs(1), shareable(true) {}
+  };
+
+  typedef typename allocator_type::template rebind<_rep>::other rep_allocator;
+
+  allocator_type _alloc;
+  _rep* _rep_;  // NULL 이면 비어 있다.
+
+ public:
+  // SECTION: constructor and destructor
+  explicit cow_vector(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _rep_(NULL) {}
+
+  explicit cow_vector(size_type n, const value_type& val = value_type(),
+                      const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _rep_(NULL) {
+    if (n != 0) {
+      vector_type data(n, val, alloc);
+      _rep_ = _new_rep(data);
+    }
+  }
+
+  template <typename InputIterator>
+  cow_vector(InputIterator first,
+             typename enable_if<is_input_iterator<InputIterator>::value,
+                                InputIterator>::type last,
+             const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _rep_(NULL) {
+    if (first != last) {
+      vector_type data(first, last, alloc);
+      _rep_ = _new_rep(data);
+    }
+  }
+
+  explicit cow_vector(const vector_type& x)
+      : _alloc(x.get_allocator()), _rep_(NULL) {
+    if (!x.empty()) {
+      vector_type data(x);
+      _rep_ = _new_rep(data);
+    }
+  }
+
+  // STRONG
+  /**
+   * @brief storage 를 공유한다. x 가 수정 가능한 reference 를 내준 상태면
+   * 복사한다.
+   * @complexity O(1), x 가 공유할 수 없는 상태면 O(N)
+   */
+  cow_vector(const cow_vector& x) : _alloc(x._alloc), _rep_(x._share()) {}
+
+  // NOTHROW
+  ~cow_vector(void) { _release(); }
+  // !SECTION: constructor and destructor
+
+  // STRONG
+  cow_vector& operator=(const cow_vector& x) {
+    if (_rep_ != x._rep_) {
+      _rep* other = x._share();
+      _release();
+      _rep_ = other;
+    }
+    return *this;
+  }
+
+  // SECTION: iterator
+  // const 가 아닌 iterator 는 공유를 푼다.
+  iterator begin(void) { return _mutable().begin(); }
+  const_iterator begin(void) const { return _view().begin(); }
+
+  iterator end(void) { return _mutable().end(); }
+  const_iterator end(void) const { return _view().end(); }
+
+  reverse_iterator rbegin(void) { return _mutable().rbegin(); }
+  const_reverse_iterator rbegin(void) const { return _view().rbegin(); }
+
+  reverse_iterator rend(void) { return _mutable().rend(); }
+  const_reverse_iterator rend(void) const { return _view().rend(); }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return _view().size(); }
+
+  size_type max_size(void) const { return _view().max_size(); }
+
+  // STRONG n > size and reallocation required
+  // BASIC otherwise
+  void resize(size_type n, value_type val = value_type()) {
+    if (n != size()) {
+      _modify().resize(n, val);
+    }
+  }
+
+  size_type capacity(void) const { return _view().capacity(); }
+
+  bool empty(void) const { return _view().empty(); }
+
+  // STRONG
+  void reserve(size_type n) {
+    if (n > capacity()) {
+      _modify().reserve(n);
+    }
+  }
+
+  // STRONG
+  void shrink_to_fit(void) {
+    if (capacity() > size()) {
+      _modify().shrink_to_fit();
+    }
+  }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  reference operator[](size_type n) { return _mutable()[n]; }
+  const_reference operator[](size_type n) const { return _view()[n]; }
+
+  reference at(size_type n) { return _mutable().at(n); }
+  const_reference at(size_type n) const { return _view().at(n); }
+
+  reference front(void) { return _mutable().front(); }
+  const_reference front(void) const { return _view().front(); }
+
+  reference back(void) { return _mutable().back(); }
+  const_reference back(void) const { return _view().back(); }
+
+  value_type* data(void) { return _mutable().data(); }
+  const value_type* data(void) const { return _view().data(); }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // STRONG
+  /**
+   * @brief 새 내용으로 바꾼다. 공유 중이던 storage 는 복사하지 않고 놓는다.
+   */
+  template <typename InputIterator>
+  void assign(InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    cow_vector(first, last, _alloc).swap(*this);
+  }
+
+  void assign(size_type n, const value_type& val) {
+    cow_vector(n, val, _alloc).swap(*this);
+  }
+
+  // STRONG
+  void push_back(const value_type& val) { _modify().push_back(val); }
+
+  // STRONG if the storage is shared (clone)
+  // NOTHROW otherwise
+  void pop_back(void) { _modify().pop_back(); }
+
+  // STRONG insert at the end or reallocation
+  // BASIC otherwise
+  iterator insert(iterator position, const value_type& val) {
+    return _mutable().insert(position, val);
+  }
+
+  void insert(iterator position, size_type n, const value_type& val) {
+    _mutable().insert(position, n, val);
+  }
+
+  template <typename InputIterator>
+  void insert(iterator position, InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    _mutable().insert(position, first, last);
+  }
+
+  // BASIC
+  iterator erase(iterator position) { return _mutable().erase(position); }
+
+  iterator erase(iterator first, iterator last) {
+    return _mutable().erase(first, last);
+  }
+
+  // NOTHROW
+  void swap(cow_vector& x) {
+    ft::swap(_alloc, x._alloc);
+    ft::swap(_rep_, x._rep_);
+  }
+
+  // NOTHROW
+  /**
+   * @brief 공유 중이면 storage 를 놓기만 하고, 아니면 vector::clear 처럼
+   * capacity 를 남긴다.
+   */
+  void clear(void) {
+    if (_rep_ == NULL) {
+      return;
+    }
+    if (_load(_rep_->refs) > 1) {
+      _release();
+      _rep_ = NULL;
+      return;
+    }
+    _rep_->data.clear();
+    _rep_->shareable = true;
+  }
+  // !SECTION: modifiers
+
+  // SECTION: sharing
+  /**
+   * @brief storage 를 다른 객체와 공유하고 있으면 지금 복사해서 혼자 갖는다.
+   * 이후의 수정이 복사 비용 없이 일어나도록 미리 부를 때 사용한다.
+   * @complexity 공유 중이면 O(N), 아니면 O(1)
+   */
+  void unshare(void) {
+    if (_rep_ != NULL && _load(_rep_->refs) > 1) {
+      _clone();
+    }
+  }
+
+  /**
+   * @brief storage 를 다른 객체와 공유하고 있는지 여부
+   */
+  bool is_shared(void) const {
+    return _rep_ != NULL && _load(_rep_->refs) > 1;
+  }
+
+  /**
+   * @brief 이 storage 를 공유하는 객체의 수. 비어 있으면 0.
+   */
+  size_type use_count(void) const {
+    return _rep_ == NULL ? 0 : _load(_rep_->refs);
+  }
+  // !SECTION: sharing
+
+  allocator_type get_allocator(void) const { return _alloc; }
+
+  // SECTION: private functions
+ private:
+  static size_type _load(const size_type& refs) {
+    return __atomic_load_n(&refs, __ATOMIC_ACQUIRE);
+  }
+
+  static const vector_type& _empty(void) {
+    static const vector_type empty;
+    return empty;
+  }
+
+  const vector_type& _view(void) const {
+    return _rep_ == NULL ? _empty() : _rep_->data;
+  }
+
+  /**
+   * @brief 내용을 바꾸기 전에 부른다. 공유 중이면 복사한다.
+   */
+  vector_type& _modify(void) {
+    if (_rep_ == NULL) {
+      vector_type data(_alloc);
+      _rep_ = _new_rep(data);
+    } else if (_load(_rep_->refs) > 1) {
+      _clone();
+    }
+    return _rep_->data;
+  }
+
+  /**
+   * @brief 수정 가능한 reference 를 내줄 때 부른다. 이후의 복사는
+   * storage 를 공유하지 않는다.
+   */
+  vector_type& _mutable(void) {
+    vector_type& data = _modify();
+    _rep_->shareable = false;
+    return data;
+  }
+
+  /**
+   * @brief 복사 생성, 대입에서 줄 storage. 공유할 수 없으면 복사본.
+   */
+  _rep* _share(void) const {
+    if (_rep_ == NULL) {
+      return NULL;
+    }
+    if (!_rep_->shareable) {
+      vector_type data(_rep_->data);
+      return _new_rep(data);
+    }
+    __atomic_add_fetch(&_rep_->refs, 1, __ATOMIC_RELAXED);
+    return _rep_;
+  }
+
+  // STRONG
+  void _clone(void) {
+    vector_type data(_rep_->data);
+    _rep* copy = _new_rep(data);
+    _release();
+    _rep_ = copy;
+  }
+
+  /**
+   * @brief data 의 내용을 swap 으로 옮겨 담은 storage 를 만든다. element 를
+   * 다시 복사하지 않는다. 실패하면 data 는 그대로이다. (STRONG)
+   */
+  _rep* _new_rep(vector_type& data) const {
+    rep_allocator alloc(_alloc);
+    _rep* p = alloc.allocate(1);
+    try {
+      new (static_cast<void*>(p)) _rep(_alloc);
+    } catch (...) {
+      alloc.deallocate(p, 1);
+      throw;
+    }
+    p->data.swap(data);
+    return p;
+  }
+
+  /**
+   * @brief 마지막 소유자면 storage 를 해제한다.
+   */
+  void _release(void) {
+    if (_rep_ != NULL &&
+        __atomic_sub_fetch(&_rep_->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+      rep_allocator alloc(_alloc);
+      _rep_->~_rep();
+      alloc.deallocate(_rep_, 1);
+    }
+  }
+  // !SECTION: private functions
+};
+
+// SECTION: non-member function of cow_vector
+template <typename T, typename Alloc>
+bool operator==(const cow_vector<T, Alloc>& lhs,
+                const cow_vector<T, Alloc>& rhs) {
+  return (lhs.size() == rhs.size()) &&
+         equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename Alloc>
+bool operator!=(const cow_vector<T, Alloc>& lhs,
+                const cow_vector<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, typename Alloc>
+bool operator<(const cow_vector<T, Alloc>& lhs,
+               const cow_vector<T, Alloc>& rhs) {
+  return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                 rhs.end());
+}
+
+template <typename T, typename Alloc>
+bool operator>(const cow_vector<T, Alloc>& lhs,
+               const cow_vector<T, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, typename Alloc>
+bool operator<=(const cow_vector<T, Alloc>& lhs,
+                const cow_vector<T, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, typename Alloc>
+bool operator>=(const cow_vector<T, Alloc>& lhs,
+                const cow_vector<T, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <typename T, typename Alloc>
+void swap(cow_vector<T, Alloc>& x, cow_vector<T, Alloc>& y) {
+  x.swap(y);
+}
+// !SECTION: non-member function of cow_vector
+
+// 빈 cow_vector 는 storage 가 없고 swap 은 pointer 만 바꾼다.
+template <typename T, typename Alloc>
+struct is_swap_relocatable<cow_vector<T, Alloc> > : public true_type {};
+// !SECTION: cow_vector
+}  // namespace ft
+
+#endif  // COW_VECTOR_HPP
@@ -0,0 +1,812 @@
+/**
+ * @file deque.hpp
+ * @author jiskim
+ * @brief double ended queue with segmented storage
+ * @date 2023-02-21
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <algorithm>  // copy, copy_backward, rotate, reverse
+#include <memory>     // std::allocator, uninitialized_fill, uninitialized_copy
+#include <stdexcept>  // out_of_range
+
+#include "algorithm.hpp"
+#include "reverse_iterator.hpp"
+#include "type_traits.hpp"
+
+namespace ft {
+
+/**
+ * @brief block 하나에 들어가는 element 의 수.
+ * 작은 타입은 4KB block, 256 byte 이상인 타입은 16 개씩 묶는다.
+ */
+inline size_t _deque_block_size(size_t size) {
+  return size < 256 ? 4096 / size : 16;
+}
+
+// SECTION: deque iterator
+/**
+ * @brief block map 을 따라 움직이는 random access iterator.
+ * _cur 는 element, [_first, _last) 는 _cur 가 속한 block, _node 는 map 에서
+ * 그 block 을 가리키는 칸이다.
+ *
+ * @tparam T value_type
+ * @tparam Ref T& 또는 const T&
+ * @tparam Ptr T* 또는 const T*
+ */
+template <typename T, typename Ref, typename Ptr>
+struct deque_iterator {
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef T value_type;
+  typedef ptrdiff_t difference_type;
+  typedef Ptr pointer;
+  typedef Ref reference;
+
+  typedef deque_iterator<T, T&, T*> iterator;
+  typedef deque_iterator self;
+  typedef T** map_pointer;
+
+  T* _cur;
+  T* _first;
+  T* _last;
+  map_pointer _node;
+
+  deque_iterator(void) : _cur(NULL), _first(NULL), _last(NULL), _node(NULL) {}
+
+  deque_iterator(T* cur, map_pointer node)
+      : _cur(cur),
+        _first(*node),
+        _last(*node + _block_size()),
+        _node(node) {}
+
+  // iterator -> const_iterator
+  // template 이라 copy constructor 가 아니므로 복사는 암시적 버전을 쓴다.
+  template <typename R, typename P>
+  deque_iterator(
+      const deque_iterator<T, R, P>& x,
+      typename enable_if<is_same<R, T&>::value>::type* = NULL)
+      : _cur(x._cur), _first(x._first), _last(x._last), _node(x._node) {}
+
+  static difference_type _block_size(void) {
+    return static_cast<difference_type>(_deque_block_size(sizeof(T)));
+  }
+
+  void _set_node(map_pointer node) {
+    _node = node;
+    _first = *node;
+    _last = _first + _block_size();
+  }
+
+  reference operator*(void) const { return *_cur; }
+  pointer operator->(void) const { return _cur; }
+
+  self& operator++(void) {
+    if (++_cur == _last) {
+      _set_node(_node + 1);
+      _cur = _first;
+    }
+    return *this;
+  }
+  self operator++(int) {
+    self tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  self& operator--(void) {
+    if (_cur == _first) {
+      _set_node(_node - 1);
+      _cur = _last;
+    }
+    --_cur;
+    return *this;
+  }
+  self operator--(int) {
+    self tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  self& operator+=(difference_type n) {
+    const difference_type offset = n + (_cur - _first);
+    if (offset >= 0 && offset < _block_size()) {
+      _cur += n;
+    } else {
+      const difference_type node_offset =
+          offset > 0 ? offset / _block_size()
+                     : -((-offset - 1) / _block_size()) - 1;
+      _set_node(_node + node_offset);
+      _cur = _first + (offset - node_offset * _block_size());
+    }
+    return *this;
+  }
+  self& operator-=(difference_type n) { return *this += -n; }
+
+  self operator+(difference_type n) const {
+    self tmp = *this;
+    return tmp += n;
+  }
+  self operator-(difference_type n) const {
+    self tmp = *this;
+    return tmp -= n;
+  }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+};
+
+template <typename T, typename RefL, typename PtrL, typename RefR,
+          typename PtrR>
+typename deque_iterator<T, RefL, PtrL>::difference_type operator-(
+    const deque_iterator<T, RefL, PtrL>& lhs,
+    const deque_iterator<T, RefR, PtrR>& rhs) {
+  if (lhs._node == rhs._node) {
+    return lhs._cur - rhs._cur;
+  }
+  return deque_iterator<T, RefL, PtrL>::_block_size() *
+             (lhs._node - rhs._node - 1) +
+         (lhs._cur - lhs._first) + (rhs._last - rhs._cur);
+}
+
+template <typename T, typename Ref, typename Ptr>
+deque_iterator<T, Ref, Ptr> operator+(
+    typename deque_iterator<T, Ref, Ptr>::difference_type n,
+    const deque_iterator<T, Ref, Ptr>& it) {
+  return it + n;
+}
+
+template <typename T, typename RefL, typename PtrL, typename RefR,
+          typename PtrR>
+bool operator==(const deque_iterator<T, RefL, PtrL>& lhs,
+                const deque_iterator<T, RefR, PtrR>& rhs) {
+  return lhs._cur == rhs._cur;
+}
+
+template <typename T, typename RefL, typename PtrL, typename RefR,
+          typename PtrR>
+bool operator!=(const deque_iterator<T, RefL, PtrL>& lhs,
+                const deque_iterator<T, RefR, PtrR>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, typename RefL, typename PtrL, typename RefR,
+          typename PtrR>
+bool operator<(const deque_iterator<T, RefL, PtrL>& lhs,
+               const deque_iterator<T, RefR, PtrR>& rhs) {
+  return lhs._node == rhs._node ? lhs._cur < rhs._cur : lhs._node < rhs._node;
+}
+
+template <typename T, typename RefL, typename PtrL, typename RefR,
+          typename PtrR>
+bool operator>(const deque_iterator<T, RefL, PtrL>& lhs,
+               const deque_iterator<T, RefR, PtrR>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, typename RefL, typename PtrL, typename RefR,
+          typename PtrR>
+bool operator<=(const deque_iterator<T, RefL, PtrL>& lhs,
+                const deque_iterator<T, RefR, PtrR>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, typename RefL, typename PtrL, typename RefR,
+          typename PtrR>
+bool operator>=(const deque_iterator<T, RefL, PtrL>& lhs,
+                const deque_iterator<T, RefR, PtrR>& rhs) {
+  return !(lhs < rhs);
+}
+// !SECTION: deque iterator
+
+// SECTION: deque base
+/**
+ * @brief block map 과 block 의 할당, 해제를 맡는다. element 의 생성, 소멸은
+ * deque 가 한다. (vector_base 와 같은 역할)
+ *
+ * map 은 block pointer 의 배열이고 [_start._node, _finish._node] 의 block
+ * 만 할당되어 있다. _finish._cur 는 항상 할당된 block 안을 가리킨다.
+ */
+template <typename T, typename Alloc = std::allocator<T> >
+class deque_base {
+ protected:
+  typedef Alloc allocator_type;
+  typedef typename Alloc::template rebind<T*>::other map_allocator;
+  typedef deque_iterator<T, T&, T*> iterator;
+  typedef T** map_pointer;
+
+  enum { kInitialMapSize = 8 };
+
+  allocator_type _alloc;
+  map_allocator _map_alloc;
+  map_pointer _map;
+  size_t _map_size;
+  iterator _start;
+  iterator _finish;
+
+  explicit deque_base(const allocator_type& alloc)
+      : _alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0) {
+    _initialize_map(0);
+  }
+
+  deque_base(const allocator_type& alloc, size_t n)
+      : _alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0) {
+    _initialize_map(n);
+  }
+
+  ~deque_base(void) {
+    if (_map != NULL) {
+      _destroy_nodes(_start._node, _finish._node + 1);
+      _map_alloc.deallocate(_map, _map_size);
+    }
+  }
+
+  static size_t _block_size(void) { return _deque_block_size(sizeof(T)); }
+
+  T* _allocate_node(void) { return _alloc.allocate(_block_size()); }
+
+  void _deallocate_node(T* p) { _alloc.deallocate(p, _block_size()); }
+
+  /**
+   * @brief n 개의 element 가 들어갈 block 들을 map 의 가운데에 할당한다.
+   * 앞뒤로 push 할 수 있도록 map 에 여유 칸을 둔다.
+   */
+  void _initialize_map(size_t n) {
+    const size_t num_nodes = n / _block_size() + 1;
+    _map_size = max(static_cast<size_t>(kInitialMapSize), num_nodes + 2);
+    _map = _map_alloc.allocate(_map_size);
+    map_pointer nstart = _map + (_map_size - num_nodes) / 2;
+    map_pointer nfinish = nstart + num_nodes;
+    try {
+      _create_nodes(nstart, nfinish);
+    } catch (...) {
+      _map_alloc.deallocate(_map, _map_size);
+      _map = NULL;
+      _map_size = 0;
+      throw;
+    }
+    _start._set_node(nstart);
+    _start._cur = _start._first;
+    _finish._set_node(nfinish - 1);
+    _finish._cur = _finish._first + n % _block_size();
+  }
+
+  void _create_nodes(map_pointer nstart, map_pointer nfinish) {
+    map_pointer cur = nstart;
+    try {
+      for (; cur < nfinish; ++cur) {
+        *cur = _allocate_node();
+      }
+    } catch (...) {
+      _destroy_nodes(nstart, cur);  // rollback
+      throw;
+    }
+  }
+
+  void _destroy_nodes(map_pointer nstart, map_pointer nfinish) {
+    for (map_pointer n = nstart; n < nfinish; ++n) {
+      _deallocate_node(*n);
+    }
+  }
+};  // !SECTION: deque base
+
+// SECTION: deque
+/**
+ * @brief 고정 크기 block 들을 block map 으로 이어붙인 double ended queue.
+ * 양 끝의 push, pop 은 O(1) 이고, 공간이 부족하면 block 하나와 (가끔) block
+ * pointer 의 map 만 새로 할당하므로 기존 element 는 옮겨지지 않는다.
+ * 양 끝의 push, pop 은 다른 element 의 reference 를 무효화하지 않는다.
+ *
+ * stack<T, deque<T> > 처럼 adaptor 의 container 로 쓸 수 있다.
+ *
+ * @tparam T
+ * @tparam Alloc
+ */
+template <typename T, typename Alloc = std::allocator<T> >
+class deque : private deque_base<T, Alloc> {
+ public:
+  typedef T value_type;
+  typedef Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+
+  typedef deque_iterator<T, T&, T*> iterator;
+  typedef deque_iterator<T, const T&, const T*> const_iterator;
+
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+ private:
+  typedef deque_base<T, Alloc> base_;
+  typedef typename base_::map_pointer map_pointer;
+
+ public:
+  // SECTION: constructor and destructor
+  // STRONG
+  explicit deque(const allocator_type& alloc = allocator_type())
+      : base_(alloc) {}
+
+  explicit deque(size_type n, const value_type& val = value_type(),
+                 const allocator_type& alloc = allocator_type())
+      : base_(alloc, n) {
+    std::uninitialized_fill(this->_start, this->_finish, val);
+  }
+
+  template <typename InputIterator>
+  deque(InputIterator first,
+        typename enable_if<is_input_iterator<InputIterator>::value &&
+                               !is_forward_iterator<InputIterator>::value,
+                           InputIterator>::type last,
+        const allocator_type& alloc = allocator_type())
+      : base_(alloc) {
+    try {
+      for (; first != last; ++first) {
+        push_back(*first);
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  template <typename ForwardIterator>
+  deque(ForwardIterator first,
+        typename enable_if<is_forward_iterator<ForwardIterator>::value,
+                           ForwardIterator>::type last,
+        const allocator_type& alloc = allocator_type())
+      : base_(alloc, std::distance(first, last)) {
+    std::uninitialized_copy(first, last, this->_start);
+  }
+
+  deque(const deque& x) : base_(x._alloc, x.size()) {
+    std::uninitialized_copy(x.begin(), x.end(), this->_start);
+  }
+
+#if FT_HAS_MOVE
+  // 빈 deque 도 map 과 block 하나를 가지므로 할당이 필요하다.
+  deque(deque&& x) : base_(x._alloc) { swap(x); }
+#endif
+
+  // NOTHROW
+  ~deque(void) { _destroy(begin(), end()); }
+  // !SECTION: constructor and destructor
+
+  // BASIC
+  deque& operator=(const deque& x) {
+    if (this != &x) {
+      const size_type len = size();
+      if (len >= x.size()) {
+        erase(std::copy(x.begin(), x.end(), begin()), end());
+      } else {
+        const_iterator mid = x.begin() + len;
+        std::copy(x.begin(), mid, begin());
+        insert(end(), mid, x.end());
+      }
+    }
+    return *this;
+  }
+
+#if FT_HAS_MOVE
+  // NOTHROW
+  deque& operator=(deque&& x) noexcept {
+    clear();
+    swap(x);
+    return *this;
+  }
+#endif
+
+  // SECTION: iterator
+  iterator begin(void) { return this->_start; }
+  const_iterator begin(void) const { return this->_start; }
+
+  iterator end(void) { return this->_finish; }
+  const_iterator end(void) const { return this->_finish; }
+
+  reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin(void) const {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend(void) { return reverse_iterator(begin()); }
+  const_reverse_iterator rend(void) const {
+    return const_reverse_iterator(begin());
+  }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return this->_finish - this->_start; }
+
+  size_type max_size(void) const { return this->_alloc.max_size(); }
+
+  // BASIC
+  void resize(size_type n, value_type val = value_type()) {
+    const size_type len = size();
+    if (n > len) {
+      insert(end(), n - len, val);
+    } else if (n < len) {
+      erase(begin() + n, end());
+    }
+  }
+
+  bool empty(void) const { return this->_finish == this->_start; }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  // NOTHROW size > n
+  // otherwise UB
+  reference operator[](size_type n) { return this->_start[n]; }
+  const_reference operator[](size_type n) const {
+    return const_iterator(this->_start)[n];
+  }
+
+  // STRONG
+  reference at(size_type n) {
+    if (n >= size()) {
+      throw std::out_of_range("ft::deque::at n is out of range.");
+    }
+    return (*this)[n];
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("ft::deque::at n is out of range.");
+    }
+    return (*this)[n];
+  }
+
+  // NOTHROW container is not empty
+  // otherwise UB
+  reference front(void) { return *begin(); }
+  const_reference front(void) const { return *begin(); }
+
+  reference back(void) { return *(end() - 1); }
+  const_reference back(void) const { return *(end() - 1); }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // BASIC
+  template <typename InputIterator>
+  void assign(InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  void assign(size_type n, const value_type& val) {
+    clear();
+    insert(end(), n, val);
+  }
+
+  // STRONG
+  /**
+   * @brief 끝에 val 을 추가한다. 마지막 block 이 차면 block 하나를 새로
+   * 할당하고, map 이 차면 block pointer 만 새 map 으로 옮긴다.
+   * @complexity O(1) (map 재할당은 amortized)
+   */
+  void push_back(const value_type& val) {
+    if (this->_finish._cur != this->_finish._last - 1) {
+      this->_alloc.construct(this->_finish._cur, val);
+      ++this->_finish._cur;
+      return;
+    }
+    _reserve_map_at_back(1);
+    *(this->_finish._node + 1) = this->_allocate_node();
+    try {
+      this->_alloc.construct(this->_finish._cur, val);
+    } catch (...) {
+      this->_deallocate_node(*(this->_finish._node + 1));
+      throw;
+    }
+    this->_finish._set_node(this->_finish._node + 1);
+    this->_finish._cur = this->_finish._first;
+  }
+
+  // STRONG
+  void push_front(const value_type& val) {
+    if (this->_start._cur != this->_start._first) {
+      this->_alloc.construct(this->_start._cur - 1, val);
+      --this->_start._cur;
+      return;
+    }
+    _reserve_map_at_front(1);
+    *(this->_start._node - 1) = this->_allocate_node();
+    try {
+      this->_alloc.construct(*(this->_start._node - 1) +
+                                 (this->_start._block_size() - 1),
+                             val);
+    } catch (...) {
+      this->_deallocate_node(*(this->_start._node - 1));
+      throw;
+    }
+    this->_start._set_node(this->_start._node - 1);
+    this->_start._cur = this->_start._last - 1;
+  }
+
+  // NOTHROW container is not empty
+  // otherwise UB
+  void pop_back(void) {
+    if (this->_finish._cur != this->_finish._first) {
+      --this->_finish._cur;
+      this->_alloc.destroy(this->_finish._cur);
+      return;
+    }
+    this->_deallocate_node(this->_finish._first);
+    this->_finish._set_node(this->_finish._node - 1);
+    this->_finish._cur = this->_finish._last - 1;
+    this->_alloc.destroy(this->_finish._cur);
+  }
+
+  // NOTHROW container is not empty
+  // otherwise UB
+  void pop_front(void) {
+    this->_alloc.destroy(this->_start._cur);
+    if (this->_start._cur != this->_start._last - 1) {
+      ++this->_start._cur;
+      return;
+    }
+    this->_deallocate_node(this->_start._first);
+    this->_start._set_node(this->_start._node + 1);
+    this->_start._cur = this->_start._first;
+  }
+
+  // STRONG insert at either end
+  // BASIC otherwise
+  iterator insert(iterator position, const value_type& val) {
+    const difference_type offset = position - begin();
+    if (position._cur == this->_start._cur) {
+      push_front(val);
+    } else if (position._cur == this->_finish._cur) {
+      push_back(val);
+    } else {
+      insert(position, 1, val);
+    }
+    return begin() + offset;
+  }
+
+  /**
+   * @brief position 앞에 val 을 n 개 삽입한다. 가까운 쪽 끝에 push 한 뒤
+   * rotate 하므로 position 과 그 끝 사이의 element 만 움직인다.
+   * @complexity O(n + min(position - begin, end - position))
+   */
+  void insert(iterator position, size_type n, const value_type& val) {
+    const difference_type offset = position - begin();
+    if (static_cast<size_type>(offset) < size() / 2) {
+      _push_front_n(n, val);
+      std::rotate(begin(), begin() + n, begin() + (n + offset));
+    } else {
+      const size_type old_size = size();
+      _push_back_n(n, val);
+      std::rotate(begin() + offset, begin() + old_size, end());
+    }
+  }
+
+  // BASIC
+  template <typename InputIterator>
+  void insert(iterator position, InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    const difference_type offset = position - begin();
+    if (static_cast<size_type>(offset) < size() / 2) {
+      // 앞으로 하나씩 넣으면 순서가 뒤집히므로 다시 뒤집는다.
+      size_type n = 0;
+      try {
+        for (; first != last; ++first, ++n) {
+          push_front(*first);
+        }
+      } catch (...) {
+        for (; n > 0; --n) {
+          pop_front();
+        }
+        throw;
+      }
+      std::reverse(begin(), begin() + n);
+      std::rotate(begin(), begin() + n, begin() + (n + offset));
+    } else {
+      const size_type old_size = size();
+      try {
+        for (; first != last; ++first) {
+          push_back(*first);
+        }
+      } catch (...) {
+        _pop_back_to(old_size);
+        throw;
+      }
+      std::rotate(begin() + offset, begin() + old_size, end());
+    }
+  }
+
+  // BASIC
+  /**
+   * @brief position 의 element 를 지운다. 가까운 쪽 끝의 element 들을 한
+   * 칸씩 당긴다.
+   * @complexity O(min(position - begin, end - position))
+   */
+  iterator erase(iterator position) { return erase(position, position + 1); }
+
+  iterator erase(iterator first, iterator last) {
+    const difference_type offset = first - begin();
+    const difference_type n = last - first;
+    if (n == 0) {
+      return first;
+    }
+    if (static_cast<size_type>(offset) < (size() - n) / 2) {
+      std::copy_backward(begin(), first, last);
+      for (difference_type i = 0; i < n; ++i) {
+        pop_front();
+      }
+    } else {
+      std::copy(last, end(), first);
+      _pop_back_to(size() - n);
+    }
+    return begin() + offset;
+  }
+
+  // NOTHROW allocator in both deques compare equal
+  // otherwise UB
+  void swap(deque& x) {
+    ft::swap(this->_map, x._map);
+    ft::swap(this->_map_size, x._map_size);
+    ft::swap(this->_start, x._start);
+    ft::swap(this->_finish, x._finish);
+  }
+
+  // NOTHROW
+  /**
+   * @brief 모든 element 를 지우고 첫 block 하나만 남긴다.
+   */
+  void clear(void) {
+    _destroy(begin(), end());
+    this->_destroy_nodes(this->_start._node + 1, this->_finish._node + 1);
+    this->_finish = this->_start;
+  }
+  // !SECTION: modifiers
+
+  allocator_type get_allocator(void) const { return this->_alloc; }
+
+  // SECTION: private functions
+ private:
+  void _destroy(iterator first, iterator last) {
+    if (is_trivially_destructible<value_type>::value) {
+      return;
+    }
+    for (; first != last; ++first) {
+      this->_alloc.destroy(first._cur);
+    }
+  }
+
+  void _pop_back_to(size_type n) {
+    while (size() > n) {
+      pop_back();
+    }
+  }
+
+  // 실패하면 추가한 element 를 다시 뺀다.
+  void _push_back_n(size_type n, const value_type& val) {
+    const size_type old_size = size();
+    try {
+      for (size_type i = 0; i < n; ++i) {
+        push_back(val);
+      }
+    } catch (...) {
+      _pop_back_to(old_size);
+      throw;
+    }
+  }
+
+  void _push_front_n(size_type n, const value_type& val) {
+    size_type i = 0;
+    try {
+      for (; i < n; ++i) {
+        push_front(val);
+      }
+    } catch (...) {
+      for (; i > 0; --i) {
+        pop_front();
+      }
+      throw;
+    }
+  }
+
+  void _reserve_map_at_back(size_type nodes_to_add) {
+    if (nodes_to_add + 1 >
+        this->_map_size - (this->_finish._node - this->_map)) {
+      _reallocate_map(nodes_to_add, false);
+    }
+  }
+
+  void _reserve_map_at_front(size_type nodes_to_add) {
+    if (nodes_to_add >
+        static_cast<size_type>(this->_start._node - this->_map)) {
+      _reallocate_map(nodes_to_add, true);
+    }
+  }
+
+  /**
+   * @brief map 에 nodes_to_add 개의 빈 칸을 만든다. map 이 충분히 크면 사용
+   * 중인 칸을 가운데로 옮기고, 아니면 2 배 이상 큰 map 으로 옮긴다.
+   * 옮기는 것은 block pointer 뿐이고 element 는 제자리에 있다.
+   *
+   * @param nodes_to_add 필요한 칸의 수
+   * @param add_at_front 앞쪽에 칸이 필요한지
+   */
+  void _reallocate_map(size_type nodes_to_add, bool add_at_front) {
+    const size_type old_num_nodes =
+        this->_finish._node - this->_start._node + 1;
+    const size_type new_num_nodes = old_num_nodes + nodes_to_add;
+    map_pointer new_nstart;
+    if (this->_map_size > 2 * new_num_nodes) {
+      new_nstart = this->_map + (this->_map_size - new_num_nodes) / 2 +
+                   (add_at_front ? nodes_to_add : 0);
+      if (new_nstart < this->_start._node) {
+        std::copy(this->_start._node, this->_finish._node + 1, new_nstart);
+      } else {
+        std::copy_backward(this->_start._node, this->_finish._node + 1,
+                           new_nstart + old_num_nodes);
+      }
+    } else {
+      const size_type new_map_size =
+          this->_map_size + max(this->_map_size, nodes_to_add) + 2;
+      map_pointer new_map = this->_map_alloc.allocate(new_map_size);
+      new_nstart = new_map + (new_map_size - new_num_nodes) / 2 +
+                   (add_at_front ? nodes_to_add : 0);
+      std::copy(this->_start._node, this->_finish._node + 1, new_nstart);
+      this->_map_alloc.deallocate(this->_map, this->_map_size);
+      this->_map = new_map;
+      this->_map_size = new_map_size;
+    }
+    this->_start._set_node(new_nstart);
+    this->_finish._set_node(new_nstart + old_num_nodes - 1);
+  }
+  // !SECTION: private functions
+};
+
+// SECTION: non-member function of deque
+template <typename T, typename Alloc>
+bool operator==(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename Alloc>
+bool operator!=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, typename Alloc>
+bool operator<(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <typename T, typename Alloc>
+bool operator<=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, typename Alloc>
+bool operator>(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, typename Alloc>
+bool operator>=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <typename T, typename Alloc>
+void swap(deque<T, Alloc>& x, deque<T, Alloc>& y) {
+  x.swap(y);
+}
+// !SECTION: non-member function of deque
+// !SECTION: deque
+
+}  // namespace ft
+
+#endif  // DEQUE_HPP
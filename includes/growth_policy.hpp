@@ -0,0 +1,166 @@
+/**
+ * @file growth_policy.hpp
+ * @author jiskim
+ * @brief capacity growth policies of vector
+ * @date 2023-02-10
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef GROWTH_POLICY_HPP
+#define GROWTH_POLICY_HPP
+
+#include <cstddef>  // size_t
+
+#include "memory.hpp"
+#include "type_traits.hpp"
+
+namespace ft {
+
+/**
+ * GrowthPolicy 는 재할당이 필요할 때 새 capacity 를 정한다.
+ *
+ * static size_t next_capacity(size_t cap, size_t new_size, size_t max_size,
+ *                             size_t elem_size);
+ *
+ * cap        현재 capacity
+ * new_size   최소한 담아야 하는 element 의 수 (> cap)
+ * max_size   allocator 의 max_size()
+ * elem_size  sizeof(value_type)
+ *
+ * vector 는 리턴값을 [new_size, max_size] 로 clamp 해서 사용한다.
+ *
+ * 선택적으로 shrink_capacity 를 제공하면 erase, pop_back, clear, resize,
+ * assign 으로 size 가 줄어든 뒤 vector 가 capacity 를 자동으로 줄인다.
+ *
+ * static size_t shrink_capacity(size_t size, size_t cap);
+ *
+ * 리턴값이 cap 보다 작으면 capacity 를 max(리턴값, size) 로 줄인다.
+ */
+
+// SECTION: shrink policy detection
+template <typename Policy>
+struct _has_shrink_capacity_impl {
+ private:
+  struct no {};
+  struct yes {
+    no m[2];
+  };
+
+  template <typename U, size_t (*)(size_t, size_t)>
+  struct check {};
+
+  template <typename U>
+  static yes test(check<U, &U::shrink_capacity>*);
+
+  template <typename U>
+  static no test(...);
+
+ public:
+  static const bool value = sizeof(test<Policy>(0)) == sizeof(yes);
+};
+
+template <typename Policy>
+struct _has_shrink_capacity
+    : public integral_constant<bool,
+                               _has_shrink_capacity_impl<Policy>::value> {};
+// !SECTION: shrink policy detection
+
+// SECTION: growth_double
+/**
+ * @brief capacity 를 2배로 늘린다. vector 의 기본 정책.
+ * 재할당 횟수가 가장 적지만, 이전에 해제한 block 들의 합이 항상 새 block 보다
+ * 작아서 allocator 가 해제한 공간을 재사용할 수 없다.
+ */
+struct growth_double {
+  static size_t next_capacity(size_t cap, size_t new_size, size_t max_size,
+                              size_t) {
+    if (cap >= max_size / 2) {
+      return max_size;
+    }
+    return cap * 2 > new_size ? cap * 2 : new_size;
+  }
+};
+// !SECTION: growth_double
+
+// SECTION: growth_one_half
+/**
+ * @brief capacity 를 1.5배로 늘린다.
+ * 몇 번 재할당하고 나면 이전에 해제한 block 들의 합이 새 block 보다 커져서
+ * allocator 가 해제한 공간을 재사용할 수 있다.
+ */
+struct growth_one_half {
+  static size_t next_capacity(size_t cap, size_t new_size, size_t max_size,
+                              size_t) {
+    if (cap >= max_size / 3 * 2) {
+      return max_size;
+    }
+    const size_t grown = cap + cap / 2;
+    return grown > new_size ? grown : new_size;
+  }
+};
+// !SECTION: growth_one_half
+
+// SECTION: growth_page_rounded
+/**
+ * @brief 2배로 늘린 뒤 block 이 page 하나 이상이면 byte 크기를 page 단위로
+ * 올림한다. 큰 buffer 는 어차피 page 단위로 mapping 되므로 마지막 page 의 남는
+ * 공간까지 capacity 로 사용한다. page 보다 작은 block 은 growth_double 과 같다.
+ */
+struct growth_page_rounded {
+  static size_t next_capacity(size_t cap, size_t new_size, size_t max_size,
+                              size_t elem_size) {
+    const size_t grown =
+        growth_double::next_capacity(cap, new_size, max_size, elem_size);
+    if (grown >= max_size / elem_size || grown * elem_size < _page_size()) {
+      return grown;
+    }
+    return _page_round(grown * elem_size) / elem_size;
+  }
+};
+// !SECTION: growth_page_rounded
+
+// SECTION: growth_fixed
+/**
+ * @brief Increment 개씩 늘린다.
+ * 크기 상한이 정해진 queue 처럼 capacity 를 넉넉하게 잡으면 안 되는 경우에
+ * 사용한다. push_back 이 amortized O(1) 이 아니게 되므로 주의.
+ *
+ * @tparam Increment 한 번에 늘릴 element 의 수
+ */
+template <size_t Increment>
+struct growth_fixed {
+  static size_t next_capacity(size_t cap, size_t new_size, size_t max_size,
+                              size_t) {
+    if (cap >= max_size - Increment) {
+      return max_size;
+    }
+    return cap + Increment > new_size ? cap + Increment : new_size;
+  }
+};
+// !SECTION: growth_fixed
+
+// SECTION: growth_hysteresis
+/**
+ * @brief Base 정책으로 늘리고, size 가 capacity 의 1/4 보다 작아지면
+ * capacity 를 size 의 2배로 줄인다.
+ * 줄인 직후에도 절반이 비어 있으므로 경계 근처에서 push / pop 을 반복해도
+ * 재할당이 반복되지 않는다. peak 크기의 buffer 를 오래 들고 있는 worker 에
+ * 사용한다.
+ *
+ * 자동으로 줄어들 때 storage 가 옮겨질 수 있으므로 erase, pop_back 도
+ * 모든 iterator 를 무효화한다.
+ *
+ * @tparam Base next_capacity 를 제공하는 정책
+ */
+template <typename Base = growth_double>
+struct growth_hysteresis : public Base {
+  static size_t shrink_capacity(size_t size, size_t cap) {
+    return size < cap / 4 ? size * 2 : cap;
+  }
+};
+// !SECTION: growth_hysteresis
+
+}  // namespace ft
+
+#endif  // GROWTH_POLICY_HPP
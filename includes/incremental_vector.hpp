@@ -0,0 +1,544 @@
+/**
+ * @file incremental_vector.hpp
+ * @author jiskim
+ * @brief vector with de-amortized (incremental) reallocation
+ * @date 2023-02-17
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef INCREMENTAL_VECTOR_HPP
+#define INCREMENTAL_VECTOR_HPP
+
+#include <cstring>    // memcpy
+#include <memory>     // std::allocator
+#include <stdexcept>  // out_of_range, length_error
+
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "reverse_iterator.hpp"
+#include "type_traits.hpp"
+
+namespace ft {
+
+// SECTION: incremental_vector iterator
+/**
+ * @brief container 와 index 로 element 를 가리키는 random access iterator.
+ * element 가 두 block 에 나뉘어 있을 수 있으므로 pointer 대신 index 를
+ * 들고 container 의 operator[] 로 접근한다.
+ *
+ * @tparam Owner (const) container
+ * @tparam Value (const) value_type
+ */
+template <typename Owner, typename Value>
+class incremental_vector_iterator
+    : public iterator<std::random_access_iterator_tag, Value> {
+ private:
+  Owner* _owner;
+  ptrdiff_t _index;
+
+ public:
+  typedef ptrdiff_t difference_type;
+  typedef Value* pointer;
+  typedef Value& reference;
+
+  typedef incremental_vector_iterator self;
+
+  incremental_vector_iterator(void) : _owner(NULL), _index(0) {}
+  incremental_vector_iterator(Owner* owner, difference_type index)
+      : _owner(owner), _index(index) {}
+
+  template <typename Owner2, typename Value2>
+  incremental_vector_iterator(
+      const incremental_vector_iterator<Owner2, Value2>& other)
+      : _owner(other.owner()), _index(other.index()) {}
+
+  ~incremental_vector_iterator(void) {}
+
+  reference operator*(void) const { return (*_owner)[_index]; }
+  pointer operator->(void) const { return &(*_owner)[_index]; }
+
+  self& operator++(void) {
+    ++_index;
+    return *this;
+  }
+  self operator++(int) { return self(_owner, _index++); }
+
+  self& operator--(void) {
+    --_index;
+    return *this;
+  }
+  self operator--(int) { return self(_owner, _index--); }
+
+  self operator+(difference_type n) const { return self(_owner, _index + n); }
+  self operator-(difference_type n) const { return self(_owner, _index - n); }
+
+  self& operator+=(difference_type n) {
+    _index += n;
+    return *this;
+  }
+  self& operator-=(difference_type n) {
+    _index -= n;
+    return *this;
+  }
+  reference operator[](difference_type n) const {
+    return (*_owner)[_index + n];
+  }
+
+  Owner* owner(void) const { return _owner; }
+  difference_type index(void) const { return _index; }
+};
+
+template <typename O, typename V>
+incremental_vector_iterator<O, V> operator+(
+    ptrdiff_t n, const incremental_vector_iterator<O, V>& iter) {
+  return iter + n;
+}
+
+template <typename O1, typename V1, typename O2, typename V2>
+ptrdiff_t operator-(const incremental_vector_iterator<O1, V1>& lhs,
+                    const incremental_vector_iterator<O2, V2>& rhs) {
+  return lhs.index() - rhs.index();
+}
+
+template <typename O1, typename V1, typename O2, typename V2>
+bool operator==(const incremental_vector_iterator<O1, V1>& lhs,
+                const incremental_vector_iterator<O2, V2>& rhs) {
+  return lhs.index() == rhs.index();
+}
+
+template <typename O1, typename V1, typename O2, typename V2>
+bool operator!=(const incremental_vector_iterator<O1, V1>& lhs,
+                const incremental_vector_iterator<O2, V2>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename O1, typename V1, typename O2, typename V2>
+bool operator<(const incremental_vector_iterator<O1, V1>& lhs,
+               const incremental_vector_iterator<O2, V2>& rhs) {
+  return lhs.index() < rhs.index();
+}
+
+template <typename O1, typename V1, typename O2, typename V2>
+bool operator>(const incremental_vector_iterator<O1, V1>& lhs,
+               const incremental_vector_iterator<O2, V2>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename O1, typename V1, typename O2, typename V2>
+bool operator<=(const incremental_vector_iterator<O1, V1>& lhs,
+                const incremental_vector_iterator<O2, V2>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename O1, typename V1, typename O2, typename V2>
+bool operator>=(const incremental_vector_iterator<O1, V1>& lhs,
+                const incremental_vector_iterator<O2, V2>& rhs) {
+  return !(lhs < rhs);
+}
+// !SECTION: incremental_vector iterator
+
+// SECTION: incremental_vector
+/**
+ * @brief push_back 의 최악 시간이 O(1) 인 vector.
+ * 가득 차면 2배 크기의 새 block 만 할당하고, 이후 push_back 마다 이전 block
+ * 의 element 를 MIGRATE_STEP 개씩 새 block 으로 옮긴다. 이전 block 이 다
+ * 비기 전에 새 block 이 가득 차는 일은 없으므로 한 번의 push_back 이 전체를
+ * 복사하지 않는다.
+ *
+ * 옮기는 동안에는 [0, moved) 와 [old_size, size) 가 새 block 에,
+ * [moved, old_size) 가 이전 block 에 있다. operator[] 와 iterator 는 index 로
+ * 위치를 찾으므로 연속된 것처럼 보이지만 data() 는 제공하지 않는다.
+ * push_back, pop_back 은 다른 element 의 reference 를 무효화할 수 있다.
+ *
+ * @tparam T
+ * @tparam Alloc
+ */
+template <typename T, typename Alloc = std::allocator<T> >
+class incremental_vector {
+ public:
+  typedef T value_type;
+  typedef Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+
+  typedef incremental_vector_iterator<incremental_vector, value_type> iterator;
+  typedef incremental_vector_iterator<const incremental_vector,
+                                      const value_type>
+      const_iterator;
+
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+  // push_back 한 번에 옮기는 element 의 수. 2 이상이면 새 block 이 차기 전에
+  // 옮기기가 끝난다.
+  static const size_type MIGRATE_STEP = 2;
+
+ private:
+  allocator_type _alloc;
+  pointer _data;  // 새 block
+  size_type _size;
+  size_type _cap;
+  pointer _old;  // 옮기는 중인 이전 block. 없으면 NULL
+  size_type _old_cap;
+  size_type _moved;     // [0, _moved) 는 새 block 으로 옮겨졌다.
+  size_type _old_size;  // [_moved, _old_size) 는 아직 이전 block 에 있다.
+
+ public:
+  // SECTION: constructor and destructor
+  // STRONG
+  explicit incremental_vector(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _data(NULL),
+        _size(0),
+        _cap(0),
+        _old(NULL),
+        _old_cap(0),
+        _moved(0),
+        _old_size(0) {}
+
+  explicit incremental_vector(size_type n, const value_type& val = value_type(),
+                              const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _data(NULL),
+        _size(0),
+        _cap(0),
+        _old(NULL),
+        _old_cap(0),
+        _moved(0),
+        _old_size(0) {
+    try {
+      reserve(n);
+      for (; _size < n; ++_size) {
+        _alloc.construct(_data + _size, val);
+      }
+    } catch (...) {
+      _release();
+      throw;
+    }
+  }
+
+  incremental_vector(const incremental_vector& x)
+      : _alloc(x._alloc),
+        _data(NULL),
+        _size(0),
+        _cap(0),
+        _old(NULL),
+        _old_cap(0),
+        _moved(0),
+        _old_size(0) {
+    try {
+      reserve(x.size());
+      for (; _size < x.size(); ++_size) {
+        _alloc.construct(_data + _size, x[_size]);
+      }
+    } catch (...) {
+      _release();
+      throw;
+    }
+  }
+
+  // NOTHROW
+  ~incremental_vector(void) { _release(); }
+  // !SECTION: constructor and destructor
+
+  // STRONG
+  incremental_vector& operator=(const incremental_vector& x) {
+    if (this != &x) {
+      incremental_vector tmp(x);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  // SECTION: iterator
+  iterator begin(void) { return iterator(this, 0); }
+  const_iterator begin(void) const { return const_iterator(this, 0); }
+
+  iterator end(void) { return iterator(this, _size); }
+  const_iterator end(void) const { return const_iterator(this, _size); }
+
+  reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin(void) const {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend(void) { return reverse_iterator(begin()); }
+  const_reverse_iterator rend(void) const {
+    return const_reverse_iterator(begin());
+  }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return _size; }
+
+  size_type max_size(void) const { return _alloc.max_size(); }
+
+  size_type capacity(void) const { return _cap; }
+
+  bool empty(void) const { return _size == 0; }
+
+  /**
+   * @brief 이전 block 이 남아 있으면 (옮기는 중이면) true
+   */
+  bool is_migrating(void) const { return _old != NULL; }
+
+  // STRONG
+  /**
+   * @brief capacity 를 n 이상으로 만든다. 남은 element 를 한 번에 옮기므로
+   * O(N) 이다. 크기를 미리 알 때 사용한다.
+   *
+   * @param n
+   */
+  void reserve(size_type n) {
+    if (n <= _cap) {
+      return;
+    }
+    if (n > max_size()) {
+      throw std::length_error("ft::incremental_vector : n is too big");
+    }
+    pointer block = _alloc.allocate(n);
+    size_type idx = 0;
+    try {
+      for (; idx < _size; ++idx) {
+        _alloc.construct(block + idx, (*this)[idx]);
+      }
+    } catch (...) {
+      for (size_type i = 0; i < idx; ++i) {
+        _alloc.destroy(block + i);
+      }
+      _alloc.deallocate(block, n);
+      throw;
+    }
+    const size_type _size_copy = _size;
+    clear();
+    _alloc.deallocate(_data, _cap);
+    _data = block;
+    _cap = n;
+    _size = _size_copy;
+  }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  reference operator[](size_type n) { return *_slot(n); }
+  const_reference operator[](size_type n) const { return *_slot(n); }
+
+  reference at(size_type n) {
+    if (n >= size()) {
+      throw std::out_of_range("ft::incremental_vector::at n is out of range.");
+    }
+    return *_slot(n);
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("ft::incremental_vector::at n is out of range.");
+    }
+    return *_slot(n);
+  }
+
+  reference front(void) { return *_slot(0); }
+  const_reference front(void) const { return *_slot(0); }
+
+  reference back(void) { return *_slot(_size - 1); }
+  const_reference back(void) const { return *_slot(_size - 1); }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // STRONG
+  /**
+   * @brief val 을 끝에 추가한다. 새 block 을 할당하거나 MIGRATE_STEP 개를
+   * 옮기는 것 외에는 하지 않으므로 최악의 경우에도 O(1) 이다.
+   * (allocator 의 allocate 시간 제외)
+   *
+   * @param val
+   */
+  void push_back(const value_type& val) {
+    if (_old != NULL) {
+      _migrate(MIGRATE_STEP);
+    }
+    if (_size == _cap) {
+      _start_migration(val);
+      return;
+    }
+    _alloc.construct(_data + _size, val);
+    ++_size;
+  }
+
+  // NOTHROW container is not empty
+  void pop_back(void) {
+    --_size;
+    _alloc.destroy(_slot(_size));
+    if (_old != NULL && _size < _old_size) {
+      _old_size = _size;
+      if (_moved >= _old_size) {
+        _drop_old();
+      }
+    }
+  }
+
+  // NOTHROW
+  void clear(void) {
+    while (_size != 0) {
+      pop_back();
+    }
+  }
+
+  // NOTHROW
+  void swap(incremental_vector& x) {
+    ft::swap(_data, x._data);
+    ft::swap(_size, x._size);
+    ft::swap(_cap, x._cap);
+    ft::swap(_old, x._old);
+    ft::swap(_old_cap, x._old_cap);
+    ft::swap(_moved, x._moved);
+    ft::swap(_old_size, x._old_size);
+  }
+  // !SECTION: modifiers
+
+  allocator_type get_allocator(void) const { return _alloc; }
+
+  // SECTION: private functions
+ private:
+  /**
+   * @brief index 번째 element 의 위치
+   */
+  pointer _slot(size_type index) const {
+    if (_old != NULL && index >= _moved && index < _old_size) {
+      return _old + index;
+    }
+    return _data + index;
+  }
+
+  /**
+   * @brief 새 block 을 할당하고 val 을 그 끝에 construct 한다. element 는
+   * 옮기지 않는다. 실패하면 아무 것도 바뀌지 않는다.
+   *
+   * @param val
+   */
+  void _start_migration(const value_type& val) {
+    if (_old != NULL) {
+      // pop_back 없이는 일어나지 않지만, 남은 것을 다 옮긴다.
+      _migrate(_old_size - _moved);
+    }
+    const size_type _max_size = max_size();
+    if (_size >= _max_size) {
+      throw std::length_error("ft::incremental_vector : size is too big");
+    }
+    const size_type new_cap =
+        _cap == 0 ? 1 : (_cap > _max_size / 2 ? _max_size : _cap * 2);
+    pointer block = _alloc.allocate(new_cap);
+    try {
+      _alloc.construct(block + _size, val);
+    } catch (...) {
+      _alloc.deallocate(block, new_cap);
+      throw;
+    }
+    _old = _data;
+    _old_cap = _cap;
+    _old_size = _size;
+    _moved = 0;
+    _data = block;
+    _cap = new_cap;
+    ++_size;
+    if (_old_size == 0) {
+      _drop_old();
+    }
+  }
+
+  /**
+   * @brief 이전 block 의 element 를 최대 n 개 새 block 으로 옮긴다.
+   * 복사 중 예외가 나면 그 element 는 이전 block 에 그대로 남는다.
+   *
+   * @param n
+   */
+  void _migrate(size_type n) {
+    const size_type last = min(_moved + n, _old_size);
+    if (is_trivially_relocatable<value_type>::value) {
+      std::memcpy(static_cast<void*>(_data + _moved),
+                  static_cast<const void*>(_old + _moved),
+                  (last - _moved) * sizeof(value_type));
+      _moved = last;
+    } else {
+      for (; _moved < last; ++_moved) {
+        _alloc.construct(_data + _moved, _old[_moved]);
+        _alloc.destroy(_old + _moved);
+      }
+    }
+    if (_moved >= _old_size) {
+      _drop_old();
+    }
+  }
+
+  void _drop_old(void) {
+    _alloc.deallocate(_old, _old_cap);
+    _old = NULL;
+    _old_cap = 0;
+    _moved = 0;
+    _old_size = 0;
+  }
+
+  void _release(void) {
+    clear();
+    if (_old != NULL) {
+      _drop_old();
+    }
+    _alloc.deallocate(_data, _cap);
+    _data = NULL;
+    _cap = 0;
+  }
+  // !SECTION: private functions
+};
+
+// SECTION: non-member function of incremental_vector
+template <typename T, typename Alloc>
+bool operator==(const incremental_vector<T, Alloc>& lhs,
+                const incremental_vector<T, Alloc>& rhs) {
+  return (lhs.size() == rhs.size()) &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename Alloc>
+bool operator!=(const incremental_vector<T, Alloc>& lhs,
+                const incremental_vector<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, typename Alloc>
+bool operator<(const incremental_vector<T, Alloc>& lhs,
+               const incremental_vector<T, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <typename T, typename Alloc>
+bool operator>(const incremental_vector<T, Alloc>& lhs,
+               const incremental_vector<T, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, typename Alloc>
+bool operator<=(const incremental_vector<T, Alloc>& lhs,
+                const incremental_vector<T, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, typename Alloc>
+bool operator>=(const incremental_vector<T, Alloc>& lhs,
+                const incremental_vector<T, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <typename T, typename Alloc>
+void swap(incremental_vector<T, Alloc>& x, incremental_vector<T, Alloc>& y) {
+  x.swap(y);
+}
+// !SECTION: non-member function of incremental_vector
+// !SECTION: incremental_vector
+}  // namespace ft
+
+#endif  // INCREMENTAL_VECTOR_HPP
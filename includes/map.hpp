@@ -102,6 +102,16 @@ class map {
    */
   map(const map& x) : _tree(x._tree) {}
 
+#if FT_HAS_MOVE
+  /**
+   * @brief x 의 node 들을 복사하지 않고 가져온다. x 는 빈 map 가 된다.
+   * @complexity O(1)
+   *
+   * @param x
+   */
+  map(map&& x) noexcept : _tree(std::move(x._tree)) {}
+#endif
+
   // NOTHROW
   ~map(void) {}
   // !SECTION: constructor and destructor
@@ -114,6 +124,15 @@ class map {
     return *this;
   }
 
+#if FT_HAS_MOVE
+  // NOTHROW
+  // 기존 node 를 해제하고 x 의 node 들을 가져온다.
+  map& operator=(map&& x) noexcept {
+    _tree = std::move(x._tree);
+    return *this;
+  }
+#endif
+
   // SECTION: iterators
   // NOTHROW
   /**
@@ -485,6 +504,10 @@ template <typename Key, typename T, typename Compare, typename Alloc>
 void swap(map<Key, T, Compare, Alloc>& lhs, map<Key, T, Compare, Alloc>& rhs) {
   lhs.swap(rhs);
 }  // !SECTION: relational operator
+
+// 빈 map 은 node 가 없고 swap 은 header 만 바꾼다.
+template <typename Key, typename T, typename Compare, typename Alloc>
+struct is_swap_relocatable<map<Key, T, Compare, Alloc> > : public true_type {};
 // !SECTION: map
 
 }  // namespace ft
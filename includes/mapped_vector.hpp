@@ -0,0 +1,521 @@
+/**
+ * @file mapped_vector.hpp
+ * @author jiskim
+ * @brief vector whose storage is a shared file mapping
+ * @date 2023-02-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef MAPPED_VECTOR_HPP
+#define MAPPED_VECTOR_HPP
+
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, mremap, msync, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // ftruncate, close
+
+#include <algorithm>  // copy, fill
+#include <cerrno>     // errno
+#include <cstring>    // memcmp, memcpy, memmove, strerror
+#include <iterator>   // distance
+#include <limits>     // numeric_limits
+#include <stdexcept>  // out_of_range, length_error, runtime_error
+#include <string>
+
+#include "memory.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+// SECTION: mapped_vector
+/**
+ * @brief storage 가 MAP_SHARED 로 mapping 한 file 인 vector.
+ * element 는 file 에 그대로 저장되므로 다시 열면 page cache 에서 demand
+ * paging 으로 읽히고, element 단위로 다시 만들 필요가 없다.
+ * iterator 와 member 함수는 ft::vector 와 같다.
+ *
+ * file 은 kHeaderSize byte 의 header (magic, element 크기, size) 뒤에
+ * element 가 이어진다. 길이는 page 단위이고 남는 부분이 capacity 다.
+ * size 는 header 에 있으므로 변경은 바로 file 에 반영된다. (sync 전에는
+ * kernel 이 언제 disk 에 쓸지 정한다.)
+ *
+ * 늘릴 때는 ftruncate 로 file 을 키우고 mremap 으로 mapping 을 옮기므로
+ * 모든 iterator, pointer 가 무효화된다. ftruncate 는 sparse 하게 늘리므로
+ * disk 가 가득 차면 새 page 를 처음 쓸 때 SIGBUS 가 날 수 있다.
+ *
+ * @tparam T trivially copyable 한 타입 (byte 그대로 file 에 저장한다)
+ */
+template <typename T>
+class mapped_vector {
+ public:
+  typedef typename enable_if<is_trivially_copyable<T>::value, T>::type
+      value_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef const value_type* const_pointer;
+
+  typedef vector_iterator<pointer> iterator;
+  typedef vector_iterator<const_pointer> const_iterator;
+
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+  // element 가 시작하는 offset. cache line 크기라서 정렬이 유지된다.
+  static const size_type kHeaderSize = 64;
+
+ private:
+  struct _header {
+    char magic[8];
+    size_type element_size;
+    size_type size;
+  };
+
+  int _fd;
+  char* _map;
+  size_type _map_len;
+
+ public:
+  // SECTION: constructor and destructor
+  /**
+   * @brief path 를 열어 mapping 한다. file 이 없거나 비어 있으면 빈
+   * mapped_vector 로 만들고, 있으면 저장된 element 를 그대로 쓴다.
+   * 열 수 없거나 다른 타입으로 만든 file 이면 runtime_error 를 던진다.
+   *
+   * @param path
+   */
+  explicit mapped_vector(const char* path)
+      : _fd(-1), _map(NULL), _map_len(0) {
+    try {
+      _open(path);
+    } catch (...) {
+      _close();
+      throw;
+    }
+  }
+
+  // NOTHROW
+  /**
+   * @brief mapping 을 해제하고 file 을 닫는다. 내용은 page cache 에 남고
+   * kernel 이 나중에 disk 에 쓴다. 바로 써야 하면 sync() 를 먼저 부른다.
+   */
+  ~mapped_vector(void) { _close(); }
+  // !SECTION: constructor and destructor
+
+  // SECTION: iterator
+  iterator begin(void) { return iterator(_begin()); }
+  const_iterator begin(void) const { return const_iterator(_begin()); }
+
+  iterator end(void) { return iterator(_begin() + size()); }
+  const_iterator end(void) const { return const_iterator(_begin() + size()); }
+
+  reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin(void) const {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend(void) { return reverse_iterator(begin()); }
+  const_reverse_iterator rend(void) const {
+    return const_reverse_iterator(begin());
+  }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return _hdr()->size; }
+
+  size_type max_size(void) const {
+    return (static_cast<size_type>(std::numeric_limits<off_t>::max()) -
+            kHeaderSize) /
+           sizeof(value_type);
+  }
+
+  // STRONG n > capacity
+  // NOTHROW otherwise
+  void resize(size_type n, value_type val = value_type()) {
+    const size_type _size = size();
+    if (n > _size) {
+      reserve(n);
+      std::fill(_begin() + _size, _begin() + n, val);
+    }
+    _hdr()->size = n;
+  }
+
+  size_type capacity(void) const {
+    return (_map_len - kHeaderSize) / sizeof(value_type);
+  }
+
+  bool empty(void) const { return size() == 0; }
+
+  // STRONG
+  /**
+   * @brief file 과 mapping 을 n 개 이상 담을 수 있게 늘린다.
+   * @complexity mremap 은 page table 만 옮기므로 size 와 무관하다.
+   */
+  void reserve(size_type n) {
+    if (n > capacity()) {
+      _remap(_get_alloc_size(n));
+    }
+  }
+
+  // STRONG
+  /**
+   * @brief file 을 size 가 들어가는 page 까지 줄인다.
+   */
+  void shrink_to_fit(void) {
+    if (_map_length(size()) < _map_len) {
+      _remap(size());
+    }
+  }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  reference operator[](size_type n) { return _begin()[n]; }
+  const_reference operator[](size_type n) const { return _begin()[n]; }
+
+  reference at(size_type n) {
+    if (n >= size()) {
+      throw std::out_of_range("ft::mapped_vector::at n is out of range.");
+    }
+    return _begin()[n];
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("ft::mapped_vector::at n is out of range.");
+    }
+    return _begin()[n];
+  }
+
+  reference front(void) { return *_begin(); }
+  const_reference front(void) const { return *_begin(); }
+
+  reference back(void) { return _begin()[size() - 1]; }
+  const_reference back(void) const { return _begin()[size() - 1]; }
+
+  value_type* data(void) { return _begin(); }
+  const value_type* data(void) const { return _begin(); }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // STRONG
+  template <typename InputIterator>
+  void assign(InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  void assign(size_type n, const value_type& val) {
+    const value_type val_copy = val;
+    clear();
+    resize(n, val_copy);
+  }
+
+  // STRONG
+  void push_back(const value_type& val) {
+    const size_type _size = size();
+    if (_size == capacity()) {
+      const value_type val_copy = val;  // val 이 mapping 안에 있을 수 있다.
+      reserve(_size + 1);
+      _begin()[_size] = val_copy;
+    } else {
+      _begin()[_size] = val;
+    }
+    _hdr()->size = _size + 1;
+  }
+
+  // NOTHROW container is not empty
+  void pop_back(void) { --_hdr()->size; }
+
+  // STRONG
+  iterator insert(iterator position, const value_type& val) {
+    const difference_type offset = position - begin();
+    insert(position, 1, val);
+    return begin() + offset;
+  }
+
+  void insert(iterator position, size_type n, const value_type& val) {
+    if (n == 0) {
+      return;
+    }
+    const value_type val_copy = val;
+    pointer p = _make_gap(position - begin(), n);
+    std::fill(p, p + n, val_copy);
+  }
+
+  template <typename InputIterator>
+  void insert(iterator position, InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value &&
+                                     !is_forward_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    ft::vector<value_type> tmp(first, last);
+    insert(position, tmp.begin(), tmp.end());
+  }
+
+  /**
+   * @brief [first, last) 가 이 mapped_vector 의 element 이면 mapping 이
+   * 옮겨질 수 있으므로 먼저 복사해둔다.
+   */
+  template <typename ForwardIterator>
+  void insert(iterator position, ForwardIterator first,
+              typename enable_if<is_forward_iterator<ForwardIterator>::value,
+                                 ForwardIterator>::type last) {
+    const size_type n = std::distance(first, last);
+    if (n == 0) {
+      return;
+    }
+    if (_overlaps(first, n)) {
+      ft::vector<value_type> tmp(first, last);
+      insert(position, tmp.begin(), tmp.end());
+      return;
+    }
+    std::copy(first, last, _make_gap(position - begin(), n));
+  }
+
+  // NOTHROW
+  iterator erase(iterator position) { return erase(position, position + 1); }
+
+  iterator erase(iterator first, iterator last) {
+    const size_type _size = size();
+    pointer first_p = _begin() + (first - begin());
+    pointer last_p = _begin() + (last - begin());
+    if (first_p != last_p) {
+      std::memmove(static_cast<void*>(first_p), static_cast<void*>(last_p),
+                   (_begin() + _size - last_p) * sizeof(value_type));
+      _hdr()->size = _size - (last_p - first_p);
+    }
+    return iterator(first_p);
+  }
+
+  // NOTHROW
+  /**
+   * @brief 열린 file 을 바꾼다. iterator 는 element 를 따라간다.
+   */
+  void swap(mapped_vector& x) {
+    ft::swap(_fd, x._fd);
+    ft::swap(_map, x._map);
+    ft::swap(_map_len, x._map_len);
+  }
+
+  // NOTHROW
+  /**
+   * @brief size 를 0 으로 만든다. file 의 길이 (capacity) 는 그대로다.
+   */
+  void clear(void) { _hdr()->size = 0; }
+  // !SECTION: modifiers
+
+  /**
+   * @brief 바뀐 page 를 msync 로 disk 에 쓴다. 실패하면 runtime_error.
+   */
+  void sync(void) {
+    if (msync(_map, _map_len, MS_SYNC) != 0) {
+      _throw_errno("msync");
+    }
+  }
+
+  // SECTION: private functions
+ private:
+  // 복사하면 같은 file 을 두 mapping 이 나눠 쓰게 되므로 막는다.
+  mapped_vector(const mapped_vector&);
+  mapped_vector& operator=(const mapped_vector&);
+
+  _header* _hdr(void) { return reinterpret_cast<_header*>(_map); }
+  const _header* _hdr(void) const {
+    return reinterpret_cast<const _header*>(_map);
+  }
+
+  pointer _begin(void) { return reinterpret_cast<pointer>(_map + kHeaderSize); }
+  const_pointer _begin(void) const {
+    return reinterpret_cast<const_pointer>(_map + kHeaderSize);
+  }
+
+  static const char* _magic(void) { return "ftmapvec"; }
+
+  /**
+   * @brief n 개가 들어가는 file (mapping) 의 길이. page 단위로 올림한다.
+   */
+  static size_type _map_length(size_type n) {
+    return _round_up(kHeaderSize + n * sizeof(value_type), _page_size());
+  }
+
+  static void _throw_errno(const char* what) {
+    throw std::runtime_error(std::string("ft::mapped_vector : ") + what +
+                             " : " + std::strerror(errno));
+  }
+
+  void _open(const char* path) {
+    _fd = ::open(path, O_RDWR | O_CREAT, 0644);
+    if (_fd < 0) {
+      _throw_errno("open");
+    }
+    struct stat st;
+    if (fstat(_fd, &st) != 0) {
+      _throw_errno("fstat");
+    }
+    const bool created = st.st_size == 0;
+    if (created) {
+      st.st_size = _map_length(0);
+      if (ftruncate(_fd, st.st_size) != 0) {
+        _throw_errno("ftruncate");
+      }
+    } else if (static_cast<size_type>(st.st_size) < kHeaderSize) {
+      throw std::runtime_error("ft::mapped_vector : not a mapped_vector file");
+    }
+    void* p =
+        mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (p == MAP_FAILED) {
+      _throw_errno("mmap");
+    }
+    _map = static_cast<char*>(p);
+    _map_len = st.st_size;
+    if (created) {
+      std::memcpy(_hdr()->magic, _magic(), sizeof(_hdr()->magic));
+      _hdr()->element_size = sizeof(value_type);
+      _hdr()->size = 0;
+    } else if (std::memcmp(_hdr()->magic, _magic(), sizeof(_hdr()->magic)) !=
+                   0 ||
+               _hdr()->element_size != sizeof(value_type) ||
+               _hdr()->size > capacity()) {
+      throw std::runtime_error(
+          "ft::mapped_vector : file was not made for this element type");
+    }
+  }
+
+  void _close(void) {
+    if (_map != NULL) {
+      munmap(_map, _map_len);
+      _map = NULL;
+    }
+    if (_fd >= 0) {
+      ::close(_fd);
+      _fd = -1;
+    }
+  }
+
+  size_type _get_alloc_size(size_type new_size) const {
+    const size_type _max_size = max_size();
+    if (new_size > _max_size) {
+      throw std::length_error(
+          "ft::mapped_vector : reallocation size is too big");
+    }
+    const size_type cap = capacity();
+    if (cap >= _max_size / 2) {
+      return _max_size;
+    }
+    return max(2 * cap, new_size);
+  }
+
+  /**
+   * @brief file 을 n 개가 들어가는 길이로 바꾸고 mapping 을 맞춘다.
+   * 실패하면 file 길이와 mapping 을 되돌리고 runtime_error 를 던진다.
+   * (STRONG)
+   */
+  void _remap(size_type n) {
+    const size_type new_len = _map_length(n);
+    if (ftruncate(_fd, new_len) != 0) {
+      _throw_errno("ftruncate");
+    }
+#if defined(__linux__)
+    void* p = mremap(_map, _map_len, new_len, MREMAP_MAYMOVE);
+#else
+    void* p =
+        mmap(NULL, new_len, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (p != MAP_FAILED) {
+      munmap(_map, _map_len);
+    }
+#endif
+    if (p == MAP_FAILED) {
+      const int err = errno;
+      if (ftruncate(_fd, _map_len) != 0) {
+        // 원래 길이로 되돌리지 못해도 mapping 은 그대로 유효하다.
+      }
+      errno = err;
+      _throw_errno("mremap");
+    }
+    _map = static_cast<char*>(p);
+    _map_len = new_len;
+  }
+
+  /**
+   * @brief pos 에 n 개의 빈 자리를 만들고 그 위치를 리턴한다.
+   * 공간이 모자라면 먼저 늘린다. (STRONG)
+   */
+  pointer _make_gap(size_type pos, size_type n) {
+    const size_type _size = size();
+    reserve(_size + n);
+    pointer p = _begin() + pos;
+    std::memmove(static_cast<void*>(p + n), static_cast<void*>(p),
+                 (_size - pos) * sizeof(value_type));
+    _hdr()->size = _size + n;
+    return p;
+  }
+
+  template <typename ForwardIterator>
+  bool _overlaps(ForwardIterator, size_type) const {
+    return false;
+  }
+
+  bool _overlaps(const_pointer first, size_type n) const {
+    return first + n > _begin() && first < _begin() + capacity();
+  }
+
+  bool _overlaps(pointer first, size_type n) const {
+    return _overlaps(const_cast<const_pointer>(first), n);
+  }
+
+  bool _overlaps(iterator first, size_type n) const {
+    return _overlaps(first.base(), n);
+  }
+
+  bool _overlaps(const_iterator first, size_type n) const {
+    return _overlaps(first.base(), n);
+  }
+  // !SECTION: private functions
+};
+
+// SECTION: non-member function of mapped_vector
+template <typename T>
+bool operator==(const mapped_vector<T>& lhs, const mapped_vector<T>& rhs) {
+  return (lhs.size() == rhs.size()) &&
+         equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T>
+bool operator!=(const mapped_vector<T>& lhs, const mapped_vector<T>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T>
+bool operator<(const mapped_vector<T>& lhs, const mapped_vector<T>& rhs) {
+  return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                 rhs.end());
+}
+
+template <typename T>
+bool operator>(const mapped_vector<T>& lhs, const mapped_vector<T>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T>
+bool operator<=(const mapped_vector<T>& lhs, const mapped_vector<T>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T>
+bool operator>=(const mapped_vector<T>& lhs, const mapped_vector<T>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <typename T>
+void swap(mapped_vector<T>& x, mapped_vector<T>& y) {
+  x.swap(y);
+}
+// !SECTION: non-member function of mapped_vector
+// !SECTION: mapped_vector
+}  // namespace ft
+
+#endif  // MAPPED_VECTOR_HPP
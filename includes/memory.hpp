@@ -0,0 +1,696 @@
+/**
+ * @file memory.hpp
+ * @author jiskim
+ * @brief allocator extensions
+ * @date 2023-02-08
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef MEMORY_HPP
+#define MEMORY_HPP
+
+#include <sys/mman.h>  // mmap, mremap, munmap
+#include <unistd.h>    // sysconf
+
+#include <cstdlib>  // malloc, calloc, realloc, free
+#include <cstring>  // memcpy
+#include <limits>   // numeric_limits
+#include <new>      // bad_alloc, placement new
+
+#if defined(__GLIBC__)
+#include <malloc.h>  // malloc_usable_size
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>  // malloc_size
+#endif
+
+#include "type_traits.hpp"
+
+namespace ft {
+
+// SECTION: allocator hook detection
+/**
+ * @brief allocator 가 bool try_expand(pointer p, size_type old_n, size_type
+ * new_n) 를 제공하는지 판별한다.
+ * try_expand 는 p 의 block 을 제자리에서 new_n 개 크기로 늘리고, 늘릴 수
+ * 없으면 아무 것도 하지 않고 false 를 리턴해야 한다.
+ *
+ * @tparam Alloc
+ */
+template <typename Alloc>
+struct _has_try_expand_impl {
+ private:
+  struct no {};
+  struct yes {
+    no m[2];
+  };
+
+  typedef typename Alloc::pointer pointer;
+  typedef typename Alloc::size_type size_type;
+
+  template <typename U, bool (U::*)(pointer, size_type, size_type)>
+  struct check {};
+
+  template <typename U>
+  static yes test(check<U, &U::try_expand>*);
+
+  template <typename U>
+  static no test(...);
+
+ public:
+  static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);
+};
+
+template <typename Alloc>
+struct _has_try_expand
+    : public integral_constant<bool, _has_try_expand_impl<Alloc>::value> {};
+
+/**
+ * @brief allocator 가 pointer reallocate(pointer p, size_type old_n,
+ * size_type new_n) 를 제공하는지 판별한다.
+ * reallocate 는 realloc 처럼 block 을 옮길 수 있으며, 실패하면 p 를 그대로
+ * 두고 bad_alloc 을 던져야 한다.
+ *
+ * @tparam Alloc
+ */
+template <typename Alloc>
+struct _has_reallocate_impl {
+ private:
+  struct no {};
+  struct yes {
+    no m[2];
+  };
+
+  typedef typename Alloc::pointer pointer;
+  typedef typename Alloc::size_type size_type;
+
+  template <typename U, pointer (U::*)(pointer, size_type, size_type)>
+  struct check {};
+
+  template <typename U>
+  static yes test(check<U, &U::reallocate>*);
+
+  template <typename U>
+  static no test(...);
+
+ public:
+  static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);
+};
+
+template <typename Alloc>
+struct _has_reallocate
+    : public integral_constant<bool, _has_reallocate_impl<Alloc>::value> {};
+
+/**
+ * @brief allocator 가 pointer allocate_zeroed(size_type n) 를 제공하는지
+ * 판별한다.
+ * allocate_zeroed 는 모든 byte 가 0 인 block 을 할당해야 하며, 실패하면
+ * bad_alloc 을 던져야 한다. 해제는 deallocate 로 한다.
+ *
+ * @tparam Alloc
+ */
+template <typename Alloc>
+struct _has_allocate_zeroed_impl {
+ private:
+  struct no {};
+  struct yes {
+    no m[2];
+  };
+
+  typedef typename Alloc::pointer pointer;
+  typedef typename Alloc::size_type size_type;
+
+  template <typename U, pointer (U::*)(size_type)>
+  struct check {};
+
+  template <typename U>
+  static yes test(check<U, &U::allocate_zeroed>*);
+
+  template <typename U>
+  static no test(...);
+
+ public:
+  static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);
+};
+
+template <typename Alloc>
+struct _has_allocate_zeroed
+    : public integral_constant<bool, _has_allocate_zeroed_impl<Alloc>::value> {
+};
+
+/**
+ * @brief allocator 가 bool discard(pointer p, size_type used_n, size_type
+ * cap_n) 를 제공하는지 판별한다.
+ * discard 는 cap_n 개 크기 block 의 used_n 번째 이후 physical page 를
+ * 반납하고 true 를 리턴한다. block 의 크기와 주소는 그대로이고, 반납한
+ * 영역에는 다시 construct 할 수 있어야 한다.
+ *
+ * @tparam Alloc
+ */
+template <typename Alloc>
+struct _has_discard_impl {
+ private:
+  struct no {};
+  struct yes {
+    no m[2];
+  };
+
+  typedef typename Alloc::pointer pointer;
+  typedef typename Alloc::size_type size_type;
+
+  template <typename U, bool (U::*)(pointer, size_type, size_type)>
+  struct check {};
+
+  template <typename U>
+  static yes test(check<U, &U::discard>*);
+
+  template <typename U>
+  static no test(...);
+
+ public:
+  static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);
+};
+
+template <typename Alloc>
+struct _has_discard
+    : public integral_constant<bool, _has_discard_impl<Alloc>::value> {};
+
+/**
+ * @brief allocator 가 size_type usable_size(pointer p, size_type n) const 를
+ * 제공하는지 판별한다.
+ * usable_size 는 n 개로 할당한 block p 에 실제로 들어가는 element 의 수
+ * (>= n) 를 리턴한다. 이후 그 block 의 deallocate, try_expand, reallocate,
+ * discard 에는 n 대신 이 값을 넘겨도 되어야 한다.
+ *
+ * @tparam Alloc
+ */
+template <typename Alloc>
+struct _has_usable_size_impl {
+ private:
+  struct no {};
+  struct yes {
+    no m[2];
+  };
+
+  typedef typename Alloc::pointer pointer;
+  typedef typename Alloc::size_type size_type;
+
+  template <typename U, size_type (U::*)(pointer, size_type) const>
+  struct check {};
+
+  template <typename U>
+  static yes test(check<U, &U::usable_size>*);
+
+  template <typename U>
+  static no test(...);
+
+ public:
+  static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);
+};
+
+template <typename Alloc>
+struct _has_usable_size
+    : public integral_constant<bool, _has_usable_size_impl<Alloc>::value> {};
+// !SECTION: allocator hook detection
+
+// SECTION: page helpers
+inline size_t _page_size(void) {
+  static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return page;
+}
+
+inline size_t _round_up(size_t bytes, size_t unit) {
+  return (bytes + unit - 1) / unit * unit;
+}
+
+inline size_t _page_round(size_t bytes) {
+  return _round_up(bytes, _page_size());
+}
+
+/**
+ * @brief malloc 이 p 에 실제로 준 byte 수. malloc 은 요청을 size class 로
+ * 올림하므로 요청한 것보다 클 수 있다. 알 수 없는 platform 에서는 0.
+ */
+inline size_t _malloc_usable_size(void* p) {
+#if defined(__GLIBC__)
+  return malloc_usable_size(p);
+#elif defined(__APPLE__)
+  return malloc_size(p);
+#else
+  (void)p;
+  return 0;
+#endif
+}
+// !SECTION: page helpers
+
+// SECTION: mapped block
+/**
+ * @brief allocator 들이 공유하는 block 관리.
+ * Threshold byte 이상인 block 은 anonymous mmap 으로, 작은 block 은 malloc
+ * 으로 할당한다. 어느 쪽인지는 byte 수로 결정되므로 할당할 때와 같은 byte 수로
+ * 해제해야 한다.
+ *
+ * @tparam Threshold mmap 을 사용하기 시작하는 byte 수
+ * @tparam Align mapping 의 정렬 단위이자 길이의 올림 단위. 0 이면 page
+ * @tparam HugePage mapping 에 MADV_HUGEPAGE 를 적용할지 여부
+ */
+template <size_t Threshold, size_t Align, bool HugePage>
+struct _mapped_block {
+  static bool is_mapped(size_t bytes) { return bytes >= Threshold; }
+
+  static size_t unit(void) { return Align == 0 ? _page_size() : Align; }
+
+  static size_t map_length(size_t bytes) { return _round_up(bytes, unit()); }
+
+  /**
+   * @return void* 실패하면 NULL
+   */
+  static void* allocate(size_t bytes) {
+    if (!is_mapped(bytes)) {
+      return std::malloc(bytes == 0 ? 1 : bytes);
+    }
+    const size_t len = map_length(bytes);
+    // 정렬을 맞추기 위해 unit 만큼 더 mapping 하고 앞뒤를 잘라낸다.
+    const size_t extra = unit() > _page_size() ? unit() : 0;
+    void* p = mmap(NULL, len + extra, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+      return NULL;
+    }
+    char* base = static_cast<char*>(p);
+    if (extra != 0) {
+      const size_t head =
+          (unit() - reinterpret_cast<size_t>(base) % unit()) % unit();
+      if (head != 0) {
+        munmap(base, head);
+      }
+      if (extra - head != 0) {
+        munmap(base + head + len, extra - head);
+      }
+      base += head;
+    }
+    _advise(base, len);
+    return base;
+  }
+
+  /**
+   * @brief 모든 byte 가 0 인 block 을 할당한다.
+   * anonymous mmap 은 kernel 이 0 page 를 주므로 처음 만질 때까지 비용이
+   * 없고, 작은 block 은 calloc 을 사용한다.
+   * @return void* 실패하면 NULL
+   */
+  static void* allocate_zeroed(size_t bytes) {
+    if (!is_mapped(bytes)) {
+      return std::calloc(bytes == 0 ? 1 : bytes, 1);
+    }
+    return allocate(bytes);
+  }
+
+  /**
+   * @brief bytes 로 할당한 block 에 실제로 쓸 수 있는 byte 수.
+   * mapping 은 unit 단위로 올림한 길이, malloc block 은 malloc_usable_size
+   * 이다. 해제 경로가 바뀌지 않도록 malloc block 은 Threshold 아래로 자른다.
+   */
+  static size_t usable_size(void* p, size_t bytes) {
+    if (is_mapped(bytes)) {
+      return map_length(bytes);
+    }
+    const size_t usable = _malloc_usable_size(p);
+    if (usable <= bytes) {
+      return bytes;  // 알 수 없으면 요청한 만큼
+    }
+    return usable < Threshold ? usable : Threshold - 1;
+  }
+
+  static void deallocate(void* p, size_t bytes) {
+    if (p == NULL) {
+      return;
+    }
+    if (is_mapped(bytes)) {
+      munmap(p, map_length(bytes));
+    } else {
+      std::free(p);
+    }
+  }
+
+  /**
+   * @brief block 을 옮기지 않고 new_bytes 로 늘린다.
+   * mapping 의 여유분 안이거나 mremap 이 제자리에서 성공할 때만 true.
+   */
+  static bool try_expand(void* p, size_t old_bytes, size_t new_bytes) {
+    if (!is_mapped(old_bytes)) {
+      return false;
+    }
+    const size_t old_len = map_length(old_bytes);
+    const size_t new_len = map_length(new_bytes);
+    if (new_len <= old_len) {
+      return true;
+    }
+#if defined(__linux__)
+    if (mremap(p, old_len, new_len, 0) == MAP_FAILED) {
+      return false;
+    }
+    _advise(static_cast<char*>(p) + old_len, new_len - old_len);
+    return true;
+#else
+    (void)p;
+    return false;
+#endif
+  }
+
+  /**
+   * @brief mmap 된 block 의 used_bytes 이후 page 들을 MADV_DONTNEED 로
+   * kernel 에 돌려준다. mapping 은 그대로라서 다시 만지면 0 page 가 된다.
+   * @return true page 를 반납했다. (mmap 된 block)
+   */
+  static bool discard(void* p, size_t used_bytes, size_t cap_bytes) {
+    if (!is_mapped(cap_bytes)) {
+      return false;
+    }
+#if defined(MADV_DONTNEED)
+    char* first = static_cast<char*>(p) + _page_round(used_bytes);
+    char* last = static_cast<char*>(p) + map_length(cap_bytes);
+    if (first < last) {
+      madvise(first, last - first, MADV_DONTNEED);
+    }
+    return true;
+#else
+    (void)p;
+    (void)used_bytes;
+    return false;
+#endif
+  }
+
+  /**
+   * @brief realloc 처럼 block 을 옮길 수 있다.
+   * @return void* 실패하면 NULL 이고 p 는 그대로다.
+   */
+  static void* reallocate(void* p, size_t old_bytes, size_t new_bytes) {
+    const bool old_mapped = is_mapped(old_bytes);
+    const bool new_mapped = is_mapped(new_bytes);
+    if (!old_mapped && !new_mapped) {
+      return std::realloc(p, new_bytes == 0 ? 1 : new_bytes);
+    }
+#if defined(__linux__)
+    if (old_mapped && new_mapped) {
+      const size_t new_len = map_length(new_bytes);
+      void* res = mremap(p, map_length(old_bytes), new_len, MREMAP_MAYMOVE);
+      if (res == MAP_FAILED) {
+        return NULL;
+      }
+      _advise(res, new_len);
+      return res;
+    }
+#endif
+    // malloc <-> mmap 경계를 넘는 경우는 새 block 으로 복사한다.
+    void* res = allocate(new_bytes);
+    if (res == NULL) {
+      return NULL;
+    }
+    std::memcpy(res, p, old_bytes < new_bytes ? old_bytes : new_bytes);
+    deallocate(p, old_bytes);
+    return res;
+  }
+
+ private:
+  static void _advise(void* p, size_t len) {
+#if defined(MADV_HUGEPAGE)
+    if (HugePage) {
+      madvise(p, len, MADV_HUGEPAGE);
+    }
+#else
+    (void)p;
+    (void)len;
+#endif
+  }
+};
+// !SECTION: mapped block
+
+// SECTION: realloc_allocator
+/**
+ * @brief malloc / realloc 과 anonymous mmap / mremap 을 사용하는 allocator.
+ * MMAP_THRESHOLD byte 이상인 block 은 page 단위로 직접 mmap 하고,
+ * 그보다 작은 block 은 malloc 으로 받는다.
+ * 어느 쪽인지는 deallocate 에 넘어오는 n 으로 결정되므로 allocate 할 때와
+ * 같은 n 을 넘겨야 한다. (vector 는 capacity 를 넘긴다.)
+ *
+ * try_expand, reallocate hook 을 제공하므로 vector 가 재할당 시 element 를
+ * 복사하지 않고 block 을 늘릴 수 있다. allocate_zeroed hook 으로 0 으로 채운
+ * vector 는 calloc / mmap 의 0 page 를 그대로 사용한다.
+ *
+ * @tparam T
+ */
+template <typename T>
+class realloc_allocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind {
+    typedef realloc_allocator<U> other;
+  };
+
+  // glibc 의 기본 M_MMAP_THRESHOLD 와 같은 값
+  static const size_type MMAP_THRESHOLD = 128 * 1024;
+
+ private:
+  typedef _mapped_block<MMAP_THRESHOLD, 0, false> _block;
+
+ public:
+  realloc_allocator(void) throw() {}
+  realloc_allocator(const realloc_allocator&) throw() {}
+  template <typename U>
+  realloc_allocator(const realloc_allocator<U>&) throw() {}
+  ~realloc_allocator(void) throw() {}
+
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+
+  size_type max_size(void) const throw() {
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+  }
+
+  pointer allocate(size_type n, const void* = 0) {
+    void* p = n > max_size() ? NULL : _block::allocate(n * sizeof(T));
+    if (p == NULL) {
+      throw std::bad_alloc();
+    }
+    return static_cast<pointer>(p);
+  }
+
+  /**
+   * @brief 모든 byte 가 0 인 n 개 크기의 block 을 할당한다. (calloc, mmap)
+   * vector 가 0 으로 value initialization 할 때 memset 을 생략한다.
+   */
+  pointer allocate_zeroed(size_type n) {
+    void* p = n > max_size() ? NULL : _block::allocate_zeroed(n * sizeof(T));
+    if (p == NULL) {
+      throw std::bad_alloc();
+    }
+    return static_cast<pointer>(p);
+  }
+
+  void deallocate(pointer p, size_type n) {
+    _block::deallocate(static_cast<void*>(p), n * sizeof(T));
+  }
+
+  /**
+   * @brief n 개로 할당한 block p 에 실제로 들어가는 element 의 수.
+   * malloc 의 size class 나 page 올림으로 생긴 여유분까지 capacity 로 쓸 수
+   * 있게 한다. 이후 이 block 의 deallocate 등에는 이 값을 넘겨도 된다.
+   */
+  size_type usable_size(pointer p, size_type n) const {
+    const size_type usable =
+        _block::usable_size(static_cast<void*>(p), n * sizeof(T)) / sizeof(T);
+    return usable > n ? usable : n;
+  }
+
+  void construct(pointer p, const_reference val) {
+    new (static_cast<void*>(p)) T(val);
+  }
+
+  void destroy(pointer p) { p->~T(); }
+
+  /**
+   * @brief block 을 옮기지 않고 new_n 개 크기로 늘린다.
+   * mmap 된 block 만 늘릴 수 있다. (page 여유분 또는 mremap)
+   *
+   * @return true 성공. 이후 deallocate 에는 new_n 을 넘겨야 한다.
+   * @return false 실패. p 는 그대로 old_n 크기다.
+   */
+  bool try_expand(pointer p, size_type old_n, size_type new_n) {
+    return new_n <= max_size() &&
+           _block::try_expand(static_cast<void*>(p), old_n * sizeof(T),
+                              new_n * sizeof(T));
+  }
+
+  /**
+   * @brief realloc 처럼 block 을 new_n 개 크기로 바꾼다. block 이 옮겨질 수
+   * 있으므로 bitwise relocatable 한 element 에만 사용해야 한다.
+   * old_n 개 중 앞 min(old_n, new_n) 개가 보존된다.
+   *
+   * @return pointer 새 block. 실패하면 p 는 그대로이고 bad_alloc 을 던진다.
+   */
+  pointer reallocate(pointer p, size_type old_n, size_type new_n) {
+    void* res = new_n > max_size()
+                    ? NULL
+                    : _block::reallocate(static_cast<void*>(p),
+                                         old_n * sizeof(T), new_n * sizeof(T));
+    if (res == NULL) {
+      throw std::bad_alloc();
+    }
+    return static_cast<pointer>(res);
+  }
+
+  /**
+   * @brief capacity cap_n 인 block 의 used_n 번째 element 이후의 page 를
+   * 반납한다. mmap 된 block 만 가능하다. block 크기는 그대로이므로
+   * deallocate 에는 여전히 cap_n 을 넘긴다.
+   *
+   * @return true 반납했다.
+   */
+  bool discard(pointer p, size_type used_n, size_type cap_n) {
+    return _block::discard(static_cast<void*>(p), used_n * sizeof(T),
+                           cap_n * sizeof(T));
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const realloc_allocator<T>&, const realloc_allocator<U>&) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const realloc_allocator<T>&, const realloc_allocator<U>&) {
+  return false;
+}
+// !SECTION: realloc_allocator
+
+// SECTION: huge_page_allocator
+/**
+ * @brief Threshold byte 이상인 block 을 huge page 단위로 정렬된 anonymous
+ * mmap 으로 할당하고 MADV_HUGEPAGE 를 적용하는 allocator.
+ * 수 GB 짜리 buffer 의 TLB miss 를 줄이고, 이후 성장은 mremap 으로 한다.
+ * Threshold 보다 작은 block 은 malloc / realloc 을 사용한다.
+ * mapping 길이는 HUGE_PAGE_SIZE 단위로 올림되므로 Threshold 를 너무 작게
+ * 잡으면 낭비가 커진다.
+ *
+ * ft::vector<Buffer, ft::huge_page_allocator<Buffer> > buffers;
+ *
+ * @tparam T
+ * @tparam Threshold mmap 을 사용하기 시작하는 byte 수
+ */
+template <typename T, size_t Threshold = 2 * 1024 * 1024>
+class huge_page_allocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  template <typename U>
+  struct rebind {
+    typedef huge_page_allocator<U, Threshold> other;
+  };
+
+  // x86-64, aarch64 (4KB page) 의 PMD 크기
+  static const size_type HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+ private:
+  typedef _mapped_block<Threshold, HUGE_PAGE_SIZE, true> _block;
+
+ public:
+  huge_page_allocator(void) throw() {}
+  huge_page_allocator(const huge_page_allocator&) throw() {}
+  template <typename U>
+  huge_page_allocator(const huge_page_allocator<U, Threshold>&) throw() {}
+  ~huge_page_allocator(void) throw() {}
+
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+
+  size_type max_size(void) const throw() {
+    return (std::numeric_limits<size_type>::max() - HUGE_PAGE_SIZE) /
+           sizeof(T);
+  }
+
+  pointer allocate(size_type n, const void* = 0) {
+    void* p = n > max_size() ? NULL : _block::allocate(n * sizeof(T));
+    if (p == NULL) {
+      throw std::bad_alloc();
+    }
+    return static_cast<pointer>(p);
+  }
+
+  pointer allocate_zeroed(size_type n) {
+    void* p = n > max_size() ? NULL : _block::allocate_zeroed(n * sizeof(T));
+    if (p == NULL) {
+      throw std::bad_alloc();
+    }
+    return static_cast<pointer>(p);
+  }
+
+  void deallocate(pointer p, size_type n) {
+    _block::deallocate(static_cast<void*>(p), n * sizeof(T));
+  }
+
+  size_type usable_size(pointer p, size_type n) const {
+    const size_type usable =
+        _block::usable_size(static_cast<void*>(p), n * sizeof(T)) / sizeof(T);
+    return usable > n ? usable : n;
+  }
+
+  void construct(pointer p, const_reference val) {
+    new (static_cast<void*>(p)) T(val);
+  }
+
+  void destroy(pointer p) { p->~T(); }
+
+  bool try_expand(pointer p, size_type old_n, size_type new_n) {
+    return new_n <= max_size() &&
+           _block::try_expand(static_cast<void*>(p), old_n * sizeof(T),
+                              new_n * sizeof(T));
+  }
+
+  pointer reallocate(pointer p, size_type old_n, size_type new_n) {
+    void* res = new_n > max_size()
+                    ? NULL
+                    : _block::reallocate(static_cast<void*>(p),
+                                         old_n * sizeof(T), new_n * sizeof(T));
+    if (res == NULL) {
+      throw std::bad_alloc();
+    }
+    return static_cast<pointer>(res);
+  }
+
+  bool discard(pointer p, size_type used_n, size_type cap_n) {
+    return _block::discard(static_cast<void*>(p), used_n * sizeof(T),
+                           cap_n * sizeof(T));
+  }
+};
+
+template <typename T, typename U, size_t Threshold>
+bool operator==(const huge_page_allocator<T, Threshold>&,
+                const huge_page_allocator<U, Threshold>&) {
+  return true;
+}
+
+template <typename T, typename U, size_t Threshold>
+bool operator!=(const huge_page_allocator<T, Threshold>&,
+                const huge_page_allocator<U, Threshold>&) {
+  return false;
+}
+// !SECTION: huge_page_allocator
+
+}  // namespace ft
+
+#endif  // MEMORY_HPP
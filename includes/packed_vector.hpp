@@ -0,0 +1,845 @@
+/**
+ * @file packed_vector.hpp
+ * @author jiskim
+ * @brief bit packed integer vector
+ * @date 2023-02-28
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef PACKED_VECTOR_HPP
+#define PACKED_VECTOR_HPP
+
+#include <limits>     // numeric_limits
+#include <stdexcept>  // out_of_range
+
+#include "vector.hpp"
+
+namespace ft {
+
+// SECTION: bit packing
+/**
+ * @brief w 를 표현하는 데 필요한 bit 의 수. 0 이면 0.
+ */
+inline size_t _bit_width(_bit_word w) {
+#if defined(__GNUC__)
+  return w == 0 ? 0 : _word_bits - __builtin_clzl(w);
+#else
+  size_t n = 0;
+  for (; w != 0; w >>= 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+
+inline _bit_word _low_mask(size_t width) {
+  return width >= _word_bits ? ~static_cast<_bit_word>(0)
+                             : (static_cast<_bit_word>(1) << width) - 1;
+}
+
+/**
+ * @brief bit 위치 pos 에서 mask 폭의 값을 읽는다. 값이 두 word 에 걸칠 수
+ * 있으므로 항상 다음 word 까지 읽는다. (그래서 word 배열 끝에 padding
+ * word 를 둔다.) 분기가 없어서 연속으로 읽는 loop 가 pipeline 을 채운다.
+ */
+inline _bit_word _read_bits(const _bit_word* words, size_t pos,
+                            _bit_word mask) {
+  const _bit_word* p = words + pos / _word_bits;
+  const size_t off = pos % _word_bits;
+  // off 가 0 일 때 word_bits 만큼 shift 하지 않도록 두 번 나눠서 민다.
+  return ((p[0] >> off) | ((p[1] << 1) << (_word_bits - 1 - off))) & mask;
+}
+
+inline void _write_bits(_bit_word* words, size_t pos, size_t width,
+                        _bit_word mask, _bit_word value) {
+  _bit_word* p = words + pos / _word_bits;
+  const size_t off = pos % _word_bits;
+  p[0] = (p[0] & ~(mask << off)) | (value << off);
+  if (off + width > _word_bits) {
+    const size_t shift = _word_bits - off;
+    p[1] = (p[1] & ~(mask >> shift)) | (value >> shift);
+  }
+}
+
+// 값을 읽을 때 다음 word 를 함께 읽으므로 word 배열 끝에 둔다.
+const size_t _packed_padding = 2;
+
+inline size_t _packed_words(size_t bits) {
+  return (bits + _word_bits - 1) / _word_bits + _packed_padding;
+}
+
+/**
+ * @brief 정수를 word 로, word 를 정수로 바꾼다. 음수는 부호 확장된다.
+ * zigzag 는 절댓값이 작은 음수를 작은 양수로 바꾼다. (-1 -> 1, 1 -> 2)
+ */
+template <typename T>
+struct _packed_codec {
+  static _bit_word to_word(T v) { return static_cast<_bit_word>(v); }
+  static T from_word(_bit_word w) { return static_cast<T>(w); }
+
+  static _bit_word zigzag(T v) {
+    return _zigzag(v, integral_constant<bool,
+                                        std::numeric_limits<T>::is_signed>());
+  }
+
+  static T unzigzag(_bit_word w) {
+    return _unzigzag(w, integral_constant<bool,
+                                          std::numeric_limits<T>::is_signed>());
+  }
+
+ private:
+  static _bit_word _zigzag(T v, true_type) {
+    const _bit_word w = to_word(v);
+    return (w << 1) ^ (0 - (w >> (_word_bits - 1)));
+  }
+  static _bit_word _zigzag(T v, false_type) { return to_word(v); }
+
+  static T _unzigzag(_bit_word w, true_type) {
+    return from_word((w >> 1) ^ (0 - (w & 1)));
+  }
+  static T _unzigzag(_bit_word w, false_type) { return from_word(w); }
+};
+// !SECTION: bit packing
+
+// SECTION: packed encoding
+/**
+ * @brief 모든 값을 같은 bit 폭으로 저장한다. 폭은 지금까지 저장한 값 중
+ * 가장 큰 값 (음수는 zigzag) 에 맞춰 늘어난다. 폭이 늘 때 전체를 다시
+ * pack 하지만 폭은 최대 word_bits 번만 늘어난다.
+ */
+struct packed_fixed {};
+
+/**
+ * @brief _packed_block 개의 값마다 block 의 최솟값 (frame) 과 폭을 따로
+ * 저장하고 값과 최솟값의 차이만 pack 한다. timestamp, id 처럼 전체 범위는
+ * 넓지만 가까운 값끼리 모여 있는 데이터에 쓴다. 임의 접근은 그대로 O(1)
+ * 이다.
+ */
+struct packed_blocks {};
+
+const size_t _packed_block = 128;
+
+template <typename T, typename Encoding, typename Alloc>
+class _packed_store;
+
+// SECTION: packed_fixed store
+template <typename T, typename Alloc>
+class _packed_store<T, packed_fixed, Alloc> {
+ private:
+  typedef typename Alloc::template rebind<_bit_word>::other _word_allocator;
+  typedef vector<_bit_word, _word_allocator> _word_vector;
+  typedef _packed_codec<T> _codec;
+
+  _word_vector _words;
+  size_t _size;
+  size_t _width;
+  _bit_word _mask;
+
+ public:
+  explicit _packed_store(const Alloc& alloc)
+      : _words(_word_allocator(alloc)), _size(0), _width(0), _mask(0) {}
+
+  size_t size(void) const { return _size; }
+
+  size_t max_size(void) const { return _words.max_size(); }
+
+  size_t memory_usage(void) const {
+    return _words.capacity() * sizeof(_bit_word);
+  }
+
+  T get(size_t i) const {
+    return _codec::unzigzag(_read_bits(_words.data(), i * _width, _mask));
+  }
+
+  // STRONG
+  void set(size_t i, T v) {
+    const _bit_word w = _codec::zigzag(v);
+    _fit(w);
+    _write_bits(_words.data(), i * _width, _width, _mask, w);
+  }
+
+  // STRONG
+  void push_back(T v) {
+    const _bit_word w = _codec::zigzag(v);
+    _fit(w);
+    _grow(_size + 1);
+    _write_bits(_words.data(), _size * _width, _width, _mask, w);
+    ++_size;
+  }
+
+  // BASIC
+  /**
+   * @brief forward iterator 면 폭을 먼저 구해서 한 번만 다시 pack 한다.
+   */
+  template <typename InputIterator>
+  void append(InputIterator first, InputIterator last) {
+    _append(first, last, typename iterator_category_t<InputIterator>::type());
+  }
+
+  // NOTHROW
+  void truncate(size_t n) { _size = n; }
+
+  // STRONG
+  void reserve(size_t n) { _words.reserve(_packed_words(n * _width)); }
+
+  // STRONG
+  void shrink_to_fit(void) {
+    _words.resize(_size == 0 ? 0 : _packed_words(_size * _width));
+    _words.shrink_to_fit();
+  }
+
+  // NOTHROW
+  void clear(void) {
+    _words.clear();
+    _size = 0;
+    _width = 0;
+    _mask = 0;
+  }
+
+  // NOTHROW
+  void swap(_packed_store& x) {
+    _words.swap(x._words);
+    ft::swap(_size, x._size);
+    ft::swap(_width, x._width);
+    ft::swap(_mask, x._mask);
+  }
+
+  void decode(size_t first, size_t n, T* out) const {
+    const _bit_word* words = _words.data();
+    size_t pos = first * _width;
+    for (size_t i = 0; i < n; ++i, pos += _width) {
+      out[i] = _codec::unzigzag(_read_bits(words, pos, _mask));
+    }
+  }
+
+ private:
+  /**
+   * @brief w 가 지금 폭에 들어가지 않으면 폭을 늘린다.
+   */
+  void _fit(_bit_word w) {
+    if ((w & ~_mask) != 0) {
+      _repack(_bit_width(w));
+    }
+  }
+
+  void _grow(size_t n) {
+    const size_t words = _packed_words(n * _width);
+    if (_words.size() < words) {
+      _words.resize(words, 0);
+    }
+  }
+
+  // STRONG
+  void _repack(size_t width) {
+    const _bit_word mask = _low_mask(width);
+    _word_vector tmp(_packed_words(_size * width), 0, _words.get_allocator());
+    for (size_t i = 0; i < _size; ++i) {
+      _write_bits(tmp.data(), i * width, width, mask,
+                  _read_bits(_words.data(), i * _width, _mask));
+    }
+    _words.swap(tmp);
+    _width = width;
+    _mask = mask;
+  }
+
+  template <typename InputIterator>
+  void _append(InputIterator first, InputIterator last,
+               std::input_iterator_tag) {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  template <typename ForwardIterator>
+  void _append(ForwardIterator first, ForwardIterator last,
+               std::forward_iterator_tag) {
+    _bit_word bits = 0;
+    size_t n = 0;
+    for (ForwardIterator it = first; it != last; ++it, ++n) {
+      bits |= _codec::zigzag(*it);
+    }
+    _fit(bits);
+    _grow(_size + n);
+    _bit_word* words = _words.data();
+    for (size_t pos = _size * _width; first != last; ++first, pos += _width) {
+      _write_bits(words, pos, _width, _mask, _codec::zigzag(*first));
+    }
+    _size += n;
+  }
+};
+// !SECTION: packed_fixed store
+
+// SECTION: packed_blocks store
+template <typename T>
+struct _packed_frame {
+  T base;           // block 의 최솟값
+  _bit_word mask;   // _low_mask(width)
+  size_t width;     // base 와의 차이를 저장하는 폭
+  size_t offset;    // block 의 첫 word
+};
+
+template <typename T, typename Alloc>
+class _packed_store<T, packed_blocks, Alloc> {
+ private:
+  typedef typename Alloc::template rebind<_bit_word>::other _word_allocator;
+  typedef vector<_bit_word, _word_allocator> _word_vector;
+  typedef _packed_frame<T> _frame;
+  typedef typename Alloc::template rebind<_frame>::other _frame_allocator;
+  typedef vector<_frame, _frame_allocator> _frame_vector;
+  typedef _packed_codec<T> _codec;
+
+  // block 하나는 _packed_block * width bit 로 word 경계에서 끝난다.
+  _word_vector _words;
+  _frame_vector _frames;
+  size_t _size;
+
+ public:
+  explicit _packed_store(const Alloc& alloc)
+      : _words(_word_allocator(alloc)),
+        _frames(_frame_allocator(alloc)),
+        _size(0) {}
+
+  size_t size(void) const { return _size; }
+
+  size_t max_size(void) const { return _words.max_size(); }
+
+  size_t memory_usage(void) const {
+    return _words.capacity() * sizeof(_bit_word) +
+           _frames.capacity() * sizeof(_frame);
+  }
+
+  T get(size_t i) const {
+    const _frame& f = _frames[i / _packed_block];
+    return _value(f, _read_bits(_words.data() + f.offset,
+                                (i % _packed_block) * f.width, f.mask));
+  }
+
+  // STRONG
+  /**
+   * @complexity 값이 block 의 frame 에 들어가면 O(1). 아니면 block 을 다시
+   * pack 하고 뒤의 block 을 옮기므로 O(N)
+   */
+  void set(size_t i, T v) { _put(i / _packed_block, i % _packed_block, v); }
+
+  // STRONG
+  void push_back(T v) {
+    if (_size % _packed_block == 0) {
+      _open_block(&v, 1);
+    } else {
+      _put(_frames.size() - 1, _size % _packed_block, v);
+    }
+    ++_size;
+  }
+
+  // BASIC
+  /**
+   * @brief block 경계부터는 block 하나 분량을 모아서 frame 을 한 번에
+   * 정한다.
+   */
+  template <typename InputIterator>
+  void append(InputIterator first, InputIterator last) {
+    T buf[_packed_block];
+    while (first != last) {
+      if (_size % _packed_block != 0) {
+        push_back(*first);
+        ++first;
+        continue;
+      }
+      size_t n = 0;
+      for (; n < _packed_block && first != last; ++first, ++n) {
+        buf[n] = *first;
+      }
+      _open_block(buf, n);
+      _size += n;
+    }
+  }
+
+  // NOTHROW
+  void truncate(size_t n) {
+    const size_t blocks = (n + _packed_block - 1) / _packed_block;
+    if (blocks < _frames.size()) {
+      _words.resize(blocks == 0 ? 0 : _frames[blocks].offset + _packed_padding);
+      _frames.erase(_frames.begin() + blocks, _frames.end());
+    }
+    _size = n;
+  }
+
+  // STRONG
+  // frame 만 미리 잡는다. word 의 수는 값에 따라 달라진다.
+  void reserve(size_t n) {
+    _frames.reserve((n + _packed_block - 1) / _packed_block);
+  }
+
+  // STRONG
+  void shrink_to_fit(void) {
+    _words.shrink_to_fit();
+    _frames.shrink_to_fit();
+  }
+
+  // NOTHROW
+  void clear(void) {
+    _words.clear();
+    _frames.clear();
+    _size = 0;
+  }
+
+  // NOTHROW
+  void swap(_packed_store& x) {
+    _words.swap(x._words);
+    _frames.swap(x._frames);
+    ft::swap(_size, x._size);
+  }
+
+  void decode(size_t first, size_t n, T* out) const {
+    const _bit_word* words = _words.data();
+    while (n != 0) {
+      const _frame& f = _frames[first / _packed_block];
+      const size_t slot = first % _packed_block;
+      const size_t count = ft::min(n, _packed_block - slot);
+      size_t pos = slot * f.width;
+      for (size_t i = 0; i < count; ++i, pos += f.width) {
+        out[i] = _value(f, _read_bits(words + f.offset, pos, f.mask));
+      }
+      first += count;
+      out += count;
+      n -= count;
+    }
+  }
+
+ private:
+  static T _value(const _frame& f, _bit_word delta) {
+    return _codec::from_word(_codec::to_word(f.base) + delta);
+  }
+
+  static _bit_word _delta(const _frame& f, T v) {
+    return _codec::to_word(v) - _codec::to_word(f.base);
+  }
+
+  static size_t _block_words(size_t width) {
+    return _packed_block * width / _word_bits;
+  }
+
+  /**
+   * @brief values 의 최솟값을 frame 으로 하는 block 을 끝에 추가한다.
+   */
+  void _open_block(const T* values, size_t n) {
+    _frame f = _make_frame(values, n);
+    f.offset = _frames.empty() ? 0 : _words.size() - _packed_padding;
+    _frames.push_back(f);
+    try {
+      _words.resize(f.offset + _block_words(f.width) + _packed_padding, 0);
+    } catch (...) {
+      _frames.pop_back();
+      throw;
+    }
+    _write_block(f, values, n);
+  }
+
+  /**
+   * @brief block b 의 slot 에 v 를 쓴다. frame 에 들어가지 않으면 block
+   * 을 다시 pack 한다. slot 이 block 의 끝이면 push_back 이다.
+   */
+  void _put(size_t b, size_t slot, T v) {
+    const _frame& f = _frames[b];
+    if (!(v < f.base) && (_delta(f, v) & ~f.mask) == 0) {
+      _write_bits(_words.data() + f.offset, slot * f.width, f.width, f.mask,
+                  _delta(f, v));
+      return;
+    }
+    const size_t used = ft::min(_size - b * _packed_block, _packed_block);
+    T buf[_packed_block];
+    decode(b * _packed_block, used, buf);
+    buf[slot] = v;
+    _repack_block(b, buf, ft::max(used, slot + 1));
+  }
+
+  // STRONG
+  void _repack_block(size_t b, const T* values, size_t n) {
+    _frame f = _make_frame(values, n);
+    f.offset = _frames[b].offset;
+    const size_t old_words = _block_words(_frames[b].width);
+    const size_t new_words = _block_words(f.width);
+    typename _word_vector::iterator end =
+        _words.begin() + (f.offset + old_words);
+    if (new_words > old_words) {
+      _words.insert(end, new_words - old_words, 0);
+    } else {
+      _words.erase(end - (old_words - new_words), end);
+    }
+    _frames[b] = f;
+    for (size_t i = b + 1; i < _frames.size(); ++i) {
+      _frames[i].offset = _frames[i].offset + new_words - old_words;
+    }
+    _write_block(f, values, n);
+  }
+
+  static _frame _make_frame(const T* values, size_t n) {
+    T lo = values[0];
+    T hi = values[0];
+    for (size_t i = 1; i < n; ++i) {
+      lo = ft::min(lo, values[i]);
+      hi = ft::max(hi, values[i]);
+    }
+    _frame f;
+    f.base = lo;
+    f.width = _bit_width(_codec::to_word(hi) - _codec::to_word(lo));
+    f.mask = _low_mask(f.width);
+    f.offset = 0;
+    return f;
+  }
+
+  void _write_block(const _frame& f, const T* values, size_t n) {
+    _bit_word* words = _words.data() + f.offset;
+    for (size_t i = 0; i < n; ++i) {
+      _write_bits(words, i * f.width, f.width, f.mask, _delta(f, values[i]));
+    }
+  }
+};
+// !SECTION: packed_blocks store
+// !SECTION: packed encoding
+
+// SECTION: packed iterator
+/**
+ * @brief packed_vector 의 index 로 값 하나를 가리킨다. 값은 pack 되어
+ * 있으므로 reference 가 아니라 값을 리턴한다. 값을 바꿀 때는 set 을
+ * 사용한다.
+ */
+template <typename Container>
+struct _packed_iterator {
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef typename Container::value_type value_type;
+  typedef ptrdiff_t difference_type;
+  typedef const value_type* pointer;
+  typedef value_type reference;
+  typedef _packed_iterator self;
+
+  const Container* _c;
+  difference_type _i;
+
+  _packed_iterator(void) : _c(NULL), _i(0) {}
+  _packed_iterator(const Container* c, difference_type i) : _c(c), _i(i) {}
+
+  reference operator*(void) const { return (*_c)[_i]; }
+
+  self& operator++(void) {
+    ++_i;
+    return *this;
+  }
+  self operator++(int) {
+    self tmp = *this;
+    ++_i;
+    return tmp;
+  }
+
+  self& operator--(void) {
+    --_i;
+    return *this;
+  }
+  self operator--(int) {
+    self tmp = *this;
+    --_i;
+    return tmp;
+  }
+
+  self& operator+=(difference_type n) {
+    _i += n;
+    return *this;
+  }
+  self& operator-=(difference_type n) {
+    _i -= n;
+    return *this;
+  }
+
+  self operator+(difference_type n) const { return self(_c, _i + n); }
+  self operator-(difference_type n) const { return self(_c, _i - n); }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  difference_type operator-(const self& x) const { return _i - x._i; }
+
+  bool operator==(const self& x) const { return _i == x._i; }
+  bool operator!=(const self& x) const { return _i != x._i; }
+  bool operator<(const self& x) const { return _i < x._i; }
+  bool operator>(const self& x) const { return _i > x._i; }
+  bool operator<=(const self& x) const { return _i <= x._i; }
+  bool operator>=(const self& x) const { return _i >= x._i; }
+};
+
+template <typename Container>
+_packed_iterator<Container> operator+(ptrdiff_t n,
+                                      const _packed_iterator<Container>& it) {
+  return it + n;
+}
+// !SECTION: packed iterator
+
+// SECTION: packed_vector
+/**
+ * @brief 정수를 필요한 bit 폭으로만 저장하는 vector. 10 ~ 20 bit 에 들어
+ * 가는 int, long 은 ft::vector 보다 2 ~ 6 배 작다.
+ *
+ * element 는 pack 되어 있으므로 reference 를 줄 수 없다. operator[],
+ * iterator 는 값을 리턴하고 값은 set 으로 바꾼다. 여러 값을 차례로 읽을
+ * 때는 decode 로 한 번에 풀면 word 단위로 연속해서 읽는다. 중간에 insert,
+ * erase 하는 연산은 없다.
+ *
+ * @tparam T 정수 type (word 크기 이하)
+ * @tparam Encoding packed_fixed 또는 packed_blocks
+ * @tparam Alloc
+ */
+template <typename T, typename Encoding = packed_fixed,
+          typename Alloc = std::allocator<T> >
+class packed_vector {
+ public:
+  typedef typename enable_if<is_integral<T>::value &&
+                                 sizeof(T) <= sizeof(_bit_word),
+                             T>::type value_type;
+  typedef Encoding encoding;
+  typedef Alloc allocator_type;
+  typedef value_type reference;
+  typedef value_type const_reference;
+
+  typedef _packed_iterator<packed_vector> const_iterator;
+  typedef const_iterator iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+ private:
+  typedef _packed_store<T, Encoding, Alloc> _store_type;
+
+  allocator_type _alloc;
+  _store_type _store;
+
+ public:
+  // SECTION: constructor and destructor
+  explicit packed_vector(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _store(alloc) {}
+
+  // STRONG
+  explicit packed_vector(size_type n, const value_type& val = value_type(),
+                         const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _store(alloc) {
+    resize(n, val);
+  }
+
+  // STRONG
+  template <typename InputIterator>
+  packed_vector(InputIterator first,
+                typename enable_if<is_input_iterator<InputIterator>::value,
+                                   InputIterator>::type last,
+                const allocator_type& alloc = allocator_type())
+      : _alloc(alloc), _store(alloc) {
+    _store.append(first, last);
+  }
+
+  // NOTHROW
+  ~packed_vector(void) {}
+  // !SECTION: constructor and destructor
+
+  // SECTION: iterator
+  const_iterator begin(void) const { return const_iterator(this, 0); }
+
+  const_iterator end(void) const {
+    return const_iterator(this, static_cast<difference_type>(size()));
+  }
+
+  const_reverse_iterator rbegin(void) const {
+    return const_reverse_iterator(end());
+  }
+
+  const_reverse_iterator rend(void) const {
+    return const_reverse_iterator(begin());
+  }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return _store.size(); }
+
+  size_type max_size(void) const { return _store.max_size(); }
+
+  // STRONG n > size
+  // NOTHROW otherwise
+  void resize(size_type n, value_type val = value_type()) {
+    if (n > size()) {
+      _fill_iterator first(val, size());
+      _fill_iterator last(val, n);
+      _store.append(first, last);
+    } else {
+      _store.truncate(n);
+    }
+  }
+
+  bool empty(void) const { return size() == 0; }
+
+  // STRONG
+  /**
+   * @brief packed_fixed 는 지금 폭으로 n 개를 담을 word 를, packed_blocks
+   * 는 n 개의 block frame 을 미리 잡는다.
+   */
+  void reserve(size_type n) { _store.reserve(n); }
+
+  // STRONG
+  void shrink_to_fit(void) { _store.shrink_to_fit(); }
+
+  /**
+   * @brief 할당해 둔 memory 의 byte 수
+   */
+  size_type memory_usage(void) const { return _store.memory_usage(); }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  // NOTHROW size > n
+  // otherwise UB
+  value_type operator[](size_type n) const { return _store.get(n); }
+
+  value_type get(size_type n) const { return _store.get(n); }
+
+  // STRONG
+  value_type at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("ft::packed_vector::at n is out of range.");
+    }
+    return _store.get(n);
+  }
+
+  value_type front(void) const { return _store.get(0); }
+
+  value_type back(void) const { return _store.get(size() - 1); }
+
+  // STRONG
+  /**
+   * @brief n 번째 값을 바꾼다. 값이 지금 폭에 들어가지 않으면 다시 pack
+   * 한다.
+   */
+  void set(size_type n, const value_type& val) { _store.set(n, val); }
+
+  /**
+   * @brief [first, first + n) 의 값을 out 에 푼다. index 마다 operator[]
+   * 를 부르는 것보다 빠르다.
+   */
+  void decode(size_type first, size_type n, value_type* out) const {
+    _store.decode(first, n, out);
+  }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // STRONG
+  template <typename InputIterator>
+  void assign(InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    packed_vector(first, last, _alloc).swap(*this);
+  }
+
+  // STRONG
+  void assign(size_type n, const value_type& val) {
+    packed_vector(n, val, _alloc).swap(*this);
+  }
+
+  // STRONG
+  void push_back(const value_type& val) { _store.push_back(val); }
+
+  // BASIC
+  /**
+   * @brief [first, last) 를 끝에 추가한다. push_back 을 반복하는 것과 달리
+   * 폭 (packed_fixed) 이나 frame (packed_blocks) 을 범위 단위로 정한다.
+   */
+  template <typename InputIterator>
+  void append(InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    _store.append(first, last);
+  }
+
+  // NOTHROW
+  void pop_back(void) { _store.truncate(size() - 1); }
+
+  // NOTHROW
+  void swap(packed_vector& x) {
+    ft::swap(_alloc, x._alloc);
+    _store.swap(x._store);
+  }
+
+  // NOTHROW
+  void clear(void) { _store.clear(); }
+  // !SECTION: modifiers
+
+  allocator_type get_allocator(void) const { return _alloc; }
+
+ private:
+  /**
+   * @brief resize 가 같은 값 n 개를 append 로 넘길 때 쓰는 forward
+   * iterator.
+   */
+  struct _fill_iterator {
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef ptrdiff_t difference_type;
+    typedef const T* pointer;
+    typedef const T& reference;
+
+    T _val;
+    size_t _i;
+
+    _fill_iterator(T val, size_t i) : _val(val), _i(i) {}
+
+    reference operator*(void) const { return _val; }
+    _fill_iterator& operator++(void) {
+      ++_i;
+      return *this;
+    }
+    bool operator==(const _fill_iterator& x) const { return _i == x._i; }
+    bool operator!=(const _fill_iterator& x) const { return _i != x._i; }
+  };
+};
+
+// SECTION: non-member function of packed_vector
+template <typename T, typename E, typename Alloc>
+bool operator==(const packed_vector<T, E, Alloc>& lhs,
+                const packed_vector<T, E, Alloc>& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename E, typename Alloc>
+bool operator!=(const packed_vector<T, E, Alloc>& lhs,
+                const packed_vector<T, E, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, typename E, typename Alloc>
+bool operator<(const packed_vector<T, E, Alloc>& lhs,
+               const packed_vector<T, E, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <typename T, typename E, typename Alloc>
+bool operator>(const packed_vector<T, E, Alloc>& lhs,
+               const packed_vector<T, E, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, typename E, typename Alloc>
+bool operator<=(const packed_vector<T, E, Alloc>& lhs,
+                const packed_vector<T, E, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, typename E, typename Alloc>
+bool operator>=(const packed_vector<T, E, Alloc>& lhs,
+                const packed_vector<T, E, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <typename T, typename E, typename Alloc>
+void swap(packed_vector<T, E, Alloc>& x, packed_vector<T, E, Alloc>& y) {
+  x.swap(y);
+}
+// !SECTION: non-member function of packed_vector
+// !SECTION: packed_vector
+}  // namespace ft
+
+#endif  // PACKED_VECTOR_HPP
@@ -21,6 +21,10 @@ struct pair {
 
   pair(void) : first(), second() {}
 
+  // operator= 를 선언했으므로 복사 생성자도 직접 선언한다. (C++11 의
+  // -Wdeprecated-copy)
+  pair(const pair& pr) : first(pr.first), second(pr.second) {}
+
   template <typename T, typename U>
   pair(const pair<T, U>& pr) : first(pr.first), second(pr.second) {}
 
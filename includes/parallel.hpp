@@ -0,0 +1,190 @@
+/**
+ * @file parallel.hpp
+ * @author jiskim
+ * @brief opt-in multi-threaded bulk fill / copy
+ * @date 2023-02-14
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstring>  // memcpy, memset
+
+#include "algorithm.hpp"
+#include "memory.hpp"
+
+namespace ft {
+
+// SECTION: parallel config
+/**
+ * @brief [first, last) 범위를 처리하는 작업 하나. job 의 type 을 지운다.
+ */
+struct _parallel_task {
+  void (*call)(const void* job, size_t first, size_t last);
+  const void* job;
+  size_t first;
+  size_t last;
+
+  void run(void) const { call(job, first, last); }
+};
+
+/**
+ * @brief tasks[0, count) 를 모두 실행하고 끝날 때까지 기다리는 함수.
+ * parallel_pool.hpp 의 set_parallel_init 가 설치한다.
+ */
+typedef void (*_parallel_runner)(const _parallel_task* tasks, size_t count);
+
+/**
+ * @brief 큰 vector 의 fill, copy 를 여러 thread 로 나누는 설정.
+ * 기본값은 thread 1개 (꺼짐) 이고 runner 가 없으므로, parallel_pool.hpp 를
+ * include 하고 set_parallel_init 로 직접 켜야 한다. vector.hpp 는 pthread 에
+ * 의존하지 않는다.
+ */
+struct parallel_config {
+  size_t threads;
+  size_t threshold;  // 이 byte 수 이상인 작업만 나눈다.
+  _parallel_runner runner;
+};
+
+inline parallel_config& _parallel_config(void) {
+  static parallel_config config = {1, 64 * 1024 * 1024, NULL};
+  return config;
+}
+
+inline bool _use_parallel(size_t bytes) {
+  const parallel_config& config = _parallel_config();
+  return config.threads > 1 && config.runner != NULL &&
+         bytes >= config.threshold;
+}
+// !SECTION: parallel config
+
+// SECTION: parallel jobs
+/**
+ * @brief [first, last) element 범위를 처리하는 job.
+ * 여러 thread 에서 동시에 불리므로 예외를 던지면 안된다.
+ */
+template <typename T>
+struct _fill_job {
+  T* dest;
+  T val;  // val 이 dest 범위 안에 있을 수 있으므로 복사해둔다.
+
+  void operator()(size_t first, size_t last) const {
+    for (size_t i = first; i < last; ++i) {
+      std::memcpy(static_cast<void*>(dest + i),
+                  static_cast<const void*>(&val), sizeof(T));
+    }
+  }
+};
+
+template <typename T>
+struct _memset_job {
+  T* dest;
+  int byte;
+
+  void operator()(size_t first, size_t last) const {
+    std::memset(static_cast<void*>(dest + first), byte,
+                (last - first) * sizeof(T));
+  }
+};
+
+template <typename T>
+struct _copy_job {
+  T* dest;
+  const T* src;
+
+  void operator()(size_t first, size_t last) const {
+    std::memcpy(static_cast<void*>(dest + first),
+                static_cast<const void*>(src + first),
+                (last - first) * sizeof(T));
+  }
+};
+
+template <typename Job>
+void _call_job(const void* job, size_t first, size_t last) {
+  (*static_cast<const Job*>(job))(first, last);
+}
+
+/**
+ * @brief [0, n) 를 chunk 로 나눠서 설치된 runner 로 job 을 실행한다.
+ * chunk 경계는 dest 의 page 경계로 올림하므로 각 page 를 처음 만지는
+ * thread 가 하나로 정해지고 first touch page fault 도 분산된다. (page 경계에
+ * 걸친 element 하나만 두 thread 가 만진다.) runner 가 없으면 호출한 thread
+ * 가 직접 처리한다.
+ *
+ * @param job 예외를 던지지 않는 job
+ * @param dest job 이 쓰는 범위의 시작 주소
+ * @param n element 의 개수
+ * @param elem_size element 의 byte 크기
+ */
+template <typename Job>
+void _parallel_run(const Job& job, const void* dest, size_t n,
+                   size_t elem_size) {
+  const size_t kMaxThreads = 64;
+  const parallel_config& config = _parallel_config();
+  const size_t page = _page_size();
+  const size_t bytes = n * elem_size;
+  size_t threads = min(config.threads, kMaxThreads);
+  threads = min(threads, (bytes + page - 1) / page);
+  if (threads <= 1 || config.runner == NULL) {
+    job(0, n);
+    return;
+  }
+
+  // k 번째 경계: dest + k * bytes / threads 를 다음 page 주소로 올린 뒤
+  // 그 주소에서 시작하는 첫 element
+  const size_t base = reinterpret_cast<size_t>(dest);
+  size_t bound[kMaxThreads + 1];
+  bound[0] = 0;
+  bound[threads] = n;
+  for (size_t k = 1; k < threads; ++k) {
+    const size_t addr = base + bytes / threads * k;
+    const size_t offset = (addr + page - 1) / page * page - base;
+    bound[k] = min((offset + elem_size - 1) / elem_size, n);
+  }
+  _parallel_task tasks[kMaxThreads];
+  for (size_t i = 0; i < threads; ++i) {
+    tasks[i].call = _call_job<Job>;
+    tasks[i].job = &job;
+    tasks[i].first = bound[i];
+    tasks[i].last = max(bound[i], bound[i + 1]);
+  }
+  config.runner(tasks, threads);
+}
+
+/**
+ * @brief dest 에 val 을 n 개 bitwise 로 채운다. (trivially copyable 전용)
+ */
+template <typename T>
+void _parallel_fill(T* dest, size_t n, const T& val) {
+  _fill_job<T> job = {dest, val};
+  _parallel_run(job, dest, n, sizeof(T));
+}
+
+/**
+ * @brief dest 의 n 개 element 의 모든 byte 를 byte 로 채운다.
+ */
+template <typename T>
+void _parallel_memset(T* dest, size_t n, int byte) {
+  _memset_job<T> job;
+  job.dest = dest;
+  job.byte = byte;
+  _parallel_run(job, dest, n, sizeof(T));
+}
+
+/**
+ * @brief src 의 n 개 element 를 dest 로 memcpy 한다. 두 범위는 겹치면 안된다.
+ */
+template <typename T>
+void _parallel_copy(T* dest, const T* src, size_t n) {
+  _copy_job<T> job;
+  job.dest = dest;
+  job.src = src;
+  _parallel_run(job, dest, n, sizeof(T));
+}
+// !SECTION: parallel jobs
+
+}  // namespace ft
+
+#endif  // PARALLEL_HPP
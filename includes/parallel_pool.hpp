@@ -0,0 +1,180 @@
+/**
+ * @file parallel_pool.hpp
+ * @author jiskim
+ * @brief persistent pthread worker pool for the opt-in parallel fill / copy
+ * @date 2023-02-14
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef PARALLEL_POOL_HPP
+#define PARALLEL_POOL_HPP
+
+#include <pthread.h>
+
+#include "parallel.hpp"
+
+namespace ft {
+
+// SECTION: parallel pool
+/**
+ * @brief set_parallel_init 에서 한 번 만든 worker 들을 계속 재사용하는 pool.
+ * 호출한 thread 도 worker 와 같이 task 를 가져가서 처리하므로 worker 생성에
+ * 실패해도 결과는 같다. 한 번에 하나의 batch 만 돌리고, 이미 다른 thread 가
+ * pool 을 쓰고 있으면 호출한 thread 가 batch 전체를 직접 처리한다.
+ * worker 는 program 종료 시 static 소멸자에서 join 한다.
+ */
+class _parallel_pool {
+ private:
+  static const size_t kMaxWorkers = 63;
+
+  pthread_mutex_t _busy;   // batch 하나를 독점한다.
+  pthread_mutex_t _mutex;  // 아래 member 들을 보호한다.
+  pthread_cond_t _work;
+  pthread_cond_t _done;
+  pthread_t _workers[kMaxWorkers];
+  size_t _size;
+  const _parallel_task* _tasks;
+  size_t _count;
+  size_t _next;     // 다음에 가져갈 task
+  size_t _pending;  // 아직 끝나지 않은 task
+  bool _stop;
+
+ public:
+  static _parallel_pool& instance(void) {
+    static _parallel_pool pool;
+    return pool;
+  }
+
+  // NOTHROW
+  ~_parallel_pool(void) {
+    _join();
+    pthread_cond_destroy(&_done);
+    pthread_cond_destroy(&_work);
+    pthread_mutex_destroy(&_mutex);
+    pthread_mutex_destroy(&_busy);
+  }
+
+  /**
+   * @brief 기존 worker 를 모두 join 하고 workers 개를 새로 만든다.
+   * batch 를 돌리는 중에 호출하면 안된다.
+   */
+  void start(size_t workers) {
+    _join();
+    if (workers > kMaxWorkers) {
+      workers = kMaxWorkers;
+    }
+    _stop = false;
+    while (_size < workers &&
+           pthread_create(&_workers[_size], NULL, _loop, this) == 0) {
+      ++_size;
+    }
+  }
+
+  // NOTHROW
+  void run(const _parallel_task* tasks, size_t count) {
+    if (pthread_mutex_trylock(&_busy) != 0) {
+      for (size_t i = 0; i < count; ++i) {
+        tasks[i].run();
+      }
+      return;
+    }
+    pthread_mutex_lock(&_mutex);
+    _tasks = tasks;
+    _count = count;
+    _next = 0;
+    _pending = count;
+    pthread_cond_broadcast(&_work);
+    _work_on_batch();
+    while (_pending != 0) {
+      pthread_cond_wait(&_done, &_mutex);
+    }
+    _tasks = NULL;
+    _count = 0;
+    _next = 0;
+    pthread_mutex_unlock(&_mutex);
+    pthread_mutex_unlock(&_busy);
+  }
+
+ private:
+  _parallel_pool(void)
+      : _size(0), _tasks(NULL), _count(0), _next(0), _pending(0),
+        _stop(false) {
+    pthread_mutex_init(&_busy, NULL);
+    pthread_mutex_init(&_mutex, NULL);
+    pthread_cond_init(&_work, NULL);
+    pthread_cond_init(&_done, NULL);
+  }
+
+  _parallel_pool(const _parallel_pool&);
+  _parallel_pool& operator=(const _parallel_pool&);
+
+  // _mutex 를 잡은 상태로 불러야 한다. task 를 실행하는 동안만 풀어준다.
+  void _work_on_batch(void) {
+    while (_next < _count) {
+      const _parallel_task& task = _tasks[_next++];
+      pthread_mutex_unlock(&_mutex);
+      task.run();
+      pthread_mutex_lock(&_mutex);
+      if (--_pending == 0) {
+        pthread_cond_signal(&_done);
+      }
+    }
+  }
+
+  void _join(void) {
+    pthread_mutex_lock(&_mutex);
+    _stop = true;
+    pthread_cond_broadcast(&_work);
+    pthread_mutex_unlock(&_mutex);
+    for (size_t i = 0; i < _size; ++i) {
+      pthread_join(_workers[i], NULL);
+    }
+    _size = 0;
+  }
+
+  static void* _loop(void* arg) {
+    _parallel_pool* pool = static_cast<_parallel_pool*>(arg);
+    pthread_mutex_lock(&pool->_mutex);
+    while (!pool->_stop) {
+      if (pool->_next < pool->_count) {
+        pool->_work_on_batch();
+      } else {
+        pthread_cond_wait(&pool->_work, &pool->_mutex);
+      }
+    }
+    pthread_mutex_unlock(&pool->_mutex);
+    return NULL;
+  }
+};
+
+inline void _pool_runner(const _parallel_task* tasks, size_t count) {
+  _parallel_pool::instance().run(tasks, count);
+}
+// !SECTION: parallel pool
+
+/**
+ * @brief parallel 모드를 설정한다. threads 가 1 이하면 꺼진다.
+ * threads - 1 개의 worker 를 미리 만들어두고 이후의 fill / copy 에서
+ * 재사용한다. 다른 thread 에서 vector 를 사용하는 중에 호출하면 안된다.
+ *
+ * @param threads 작업을 나눌 thread 의 수 (호출한 thread 포함)
+ * @param threshold 이 byte 수 이상인 fill / copy 만 나눈다.
+ */
+inline void set_parallel_init(size_t threads,
+                              size_t threshold = 64 * 1024 * 1024) {
+  parallel_config& config = _parallel_config();
+  config.threads = threads;
+  config.threshold = threshold;
+  if (threads > 1) {
+    _parallel_pool::instance().start(threads - 1);
+    config.runner = _pool_runner;
+  } else {
+    config.runner = NULL;
+    _parallel_pool::instance().start(0);
+  }
+}
+
+}  // namespace ft
+
+#endif  // PARALLEL_POOL_HPP
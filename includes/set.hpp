@@ -61,6 +61,16 @@ class set {
 
   set(const set& x) : _tree(x._tree) {}
 
+#if FT_HAS_MOVE
+  /**
+   * @brief x 의 node 들을 복사하지 않고 가져온다. x 는 빈 set 가 된다.
+   * @complexity O(1)
+   *
+   * @param x
+   */
+  set(set&& x) noexcept : _tree(std::move(x._tree)) {}
+#endif
+
   // NOTHROW
   ~set(void) {}
   // !SECTION: constructor and destructor
@@ -71,6 +81,15 @@ class set {
     return *this;
   }
 
+#if FT_HAS_MOVE
+  // NOTHROW
+  // 기존 node 를 해제하고 x 의 node 들을 가져온다.
+  set& operator=(set&& x) noexcept {
+    _tree = std::move(x._tree);
+    return *this;
+  }
+#endif
+
   // SECTION: iterators
   iterator begin(void) { return _tree.begin(); }
   const_iterator begin(void) const { return _tree.begin(); }
@@ -208,6 +227,9 @@ void swap(set<T, Compare, Alloc>& lhs, set<T, Compare, Alloc>& rhs) {
   lhs.swap(rhs);
 }
 // !SECTION: non-member function
+
+template <typename T, typename Compare, typename Alloc>
+struct is_swap_relocatable<set<T, Compare, Alloc> > : public true_type {};
 // !SECTION: set
 
 }  // namespace ft
@@ -0,0 +1,535 @@
+/**
+ * @file small_vector.hpp
+ * @author jiskim
+ * @brief vector with inline storage
+ * @date 2023-02-13
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>  // copy, copy_backward, fill
+#include <memory>     // std::allocator, uninitialized_copy
+#include <stdexcept>  // out_of_range, length_error
+
+#include "vector.hpp"
+
+namespace ft {
+
+// SECTION: small_vector
+/**
+ * @brief 처음 N 개의 element 는 객체 안의 buffer 에 저장하고, N 개를 넘어갈
+ * 때만 allocator 로 heap 에 할당하는 vector.
+ * iterator 는 vector 와 같은 vector_iterator 이고 member 함수도 vector 와
+ * 같으므로 stack<T, small_vector<T, N> > 처럼 container 로 쓸 수 있다.
+ *
+ * inline 상태에서는 element 가 객체 안에 있으므로 swap 이 O(N) 이고,
+ * swap 후에 iterator 가 무효화된다.
+ *
+ * @tparam T
+ * @tparam N inline 으로 저장할 element 의 수
+ * @tparam Alloc heap 으로 넘어간 뒤 사용할 allocator
+ */
+template <typename T, size_t N, typename Alloc = std::allocator<T> >
+class small_vector {
+ public:
+  typedef T value_type;
+  typedef Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+
+  typedef vector_iterator<pointer> iterator;
+  typedef vector_iterator<const_pointer> const_iterator;
+
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+  static const size_type inline_capacity = N;
+
+ private:
+  // N == 0 이면 inline buffer 의 크기가 0 이 되므로 compile 에러로 막는다.
+  typedef char _inline_capacity_must_be_positive[N > 0 ? 1 : -1];
+
+  /**
+   * @brief inline buffer. c++98 에는 alignas 가 없으므로 gcc / clang 의
+   * aligned attribute 로 T 의 정렬을 그대로 맞춘다. (64 byte 정렬 타입 포함)
+   */
+  struct _inline_storage {
+    char bytes[N * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+  };
+
+  allocator_type _alloc;
+  _inline_storage _storage;
+  pointer _begin;
+  pointer _end;
+  pointer _end_cap;
+
+ public:
+  // SECTION: constructor and destructor
+  // STRONG
+  explicit small_vector(const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _begin(_inline_begin()),
+        _end(_begin),
+        _end_cap(_begin + N) {}
+
+  explicit small_vector(size_type n, const value_type& val = value_type(),
+                        const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _begin(_inline_begin()),
+        _end(_begin),
+        _end_cap(_begin + N) {
+    _reserve_empty(n);
+    try {
+      _construct_at_end(n, val);
+    } catch (...) {
+      _release();
+      throw;
+    }
+  }
+
+  template <typename InputIterator>
+  small_vector(InputIterator first,
+               typename enable_if<is_input_iterator<InputIterator>::value,
+                                  InputIterator>::type last,
+               const allocator_type& alloc = allocator_type())
+      : _alloc(alloc),
+        _begin(_inline_begin()),
+        _end(_begin),
+        _end_cap(_begin + N) {
+    try {
+      insert(end(), first, last);
+    } catch (...) {
+      _release();
+      throw;
+    }
+  }
+
+  small_vector(const small_vector& x)
+      : _alloc(x._alloc),
+        _begin(_inline_begin()),
+        _end(_begin),
+        _end_cap(_begin + N) {
+    _reserve_empty(x.size());
+    try {
+      _end = std::uninitialized_copy(x._begin, x._end, _begin);
+    } catch (...) {
+      _release();
+      throw;
+    }
+  }
+
+  // NOTHROW
+  ~small_vector(void) { _release(); }
+  // !SECTION: constructor and destructor
+
+  // BASIC
+  small_vector& operator=(const small_vector& x) {
+    if (this != &x) {
+      assign(x._begin, x._end);
+    }
+    return *this;
+  }
+
+  // SECTION: iterator
+  iterator begin(void) { return iterator(_begin); }
+  const_iterator begin(void) const { return const_iterator(_begin); }
+
+  iterator end(void) { return iterator(_end); }
+  const_iterator end(void) const { return const_iterator(_end); }
+
+  reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin(void) const {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend(void) { return reverse_iterator(begin()); }
+  const_reverse_iterator rend(void) const {
+    return const_reverse_iterator(begin());
+  }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return _end - _begin; }
+
+  size_type max_size(void) const { return _alloc.max_size(); }
+
+  // STRONG n > capacity
+  // BASIC otherwise
+  void resize(size_type n, value_type val = value_type()) {
+    const size_type _size = size();
+    if (n > _size) {
+      insert(end(), n - _size, val);
+    } else if (n < _size) {
+      _destroy_at_end(_begin + n);
+    }
+  }
+
+  size_type capacity(void) const { return _end_cap - _begin; }
+
+  bool empty(void) const { return _begin == _end; }
+
+  // STRONG
+  void reserve(size_type n) {
+    if (n > capacity()) {
+      _reallocate(_get_alloc_size(n));
+    }
+  }
+
+  /**
+   * @brief element 가 아직 객체 안의 buffer 에 있는지 여부
+   */
+  bool is_inline(void) const { return _begin == _inline_begin(); }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  reference operator[](size_type n) { return _begin[n]; }
+  const_reference operator[](size_type n) const { return _begin[n]; }
+
+  reference at(size_type n) {
+    if (n >= size()) {
+      throw std::out_of_range("ft::small_vector::at n is out of range.");
+    }
+    return _begin[n];
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("ft::small_vector::at n is out of range.");
+    }
+    return _begin[n];
+  }
+
+  reference front(void) { return *_begin; }
+  const_reference front(void) const { return *_begin; }
+
+  reference back(void) { return *(_end - 1); }
+  const_reference back(void) const { return *(_end - 1); }
+
+  value_type* data(void) { return _begin; }
+  const value_type* data(void) const { return _begin; }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // BASIC
+  template <typename InputIterator>
+  void assign(InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  void assign(size_type n, const value_type& val) {
+    const value_type val_copy = val;
+    clear();
+    insert(end(), n, val_copy);
+  }
+
+  // STRONG
+  void push_back(const value_type& val) {
+    if (_end == _end_cap) {
+      insert(end(), val);
+    } else {
+      _construct_at_end(1, val);
+    }
+  }
+
+  // NOTHROW container is not empty
+  void pop_back(void) { _alloc.destroy(--_end); }
+
+  // STRONG insert at the end or reallocation
+  // BASIC otherwise
+  iterator insert(iterator position, const value_type& val) {
+    const difference_type offset = position - begin();
+    insert(position, 1, val);
+    return begin() + offset;
+  }
+
+  void insert(iterator position, size_type n, const value_type& val) {
+    if (n == 0) {
+      return;
+    }
+    pointer p = _begin + (position - begin());
+    if (size() + n > capacity()) {
+      // STRONG
+      const size_type new_cap = _get_alloc_size(size() + n);
+      pointer new_begin = _alloc.allocate(new_cap);
+      pointer new_end = new_begin;
+      try {
+        new_end = std::uninitialized_copy(_begin, p, new_begin);
+        std::uninitialized_fill_n(new_end, n, val);
+        new_end += n;
+        new_end = std::uninitialized_copy(p, _end, new_end);
+      } catch (...) {
+        _destroy_range(new_begin, new_end);
+        _alloc.deallocate(new_begin, new_cap);
+        throw;
+      }
+      _replace_storage(new_begin, new_end, new_cap);
+      return;
+    }
+    // BASIC
+    const value_type val_copy = val;
+    pointer old_end = _end;
+    const size_type elems_after = old_end - p;
+    if (elems_after > n) {
+      _end = std::uninitialized_copy(old_end - n, old_end, old_end);
+      std::copy_backward(p, old_end - n, old_end);
+      std::fill(p, p + n, val_copy);
+    } else {
+      _construct_at_end(n - elems_after, val_copy);
+      _end = std::uninitialized_copy(p, old_end, _end);
+      std::fill(p, old_end, val_copy);
+    }
+  }
+
+  /**
+   * @brief single pass 인 input iterator 는 길이를 미리 알 수 없으므로
+   * 임시 small_vector 에 모은 뒤 한 번에 삽입한다.
+   */
+  template <typename InputIterator>
+  void insert(iterator position, InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value &&
+                                     !is_forward_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    small_vector tmp(_alloc);
+    for (; first != last; ++first) {
+      tmp.push_back(*first);
+    }
+    insert(position, tmp.begin(), tmp.end());
+  }
+
+  template <typename ForwardIterator>
+  void insert(iterator position, ForwardIterator first,
+              typename enable_if<is_forward_iterator<ForwardIterator>::value,
+                                 ForwardIterator>::type last) {
+    const size_type n = std::distance(first, last);
+    if (n == 0) {
+      return;
+    }
+    pointer p = _begin + (position - begin());
+    if (size() + n > capacity()) {
+      // STRONG
+      const size_type new_cap = _get_alloc_size(size() + n);
+      pointer new_begin = _alloc.allocate(new_cap);
+      pointer new_end = new_begin;
+      try {
+        new_end = std::uninitialized_copy(_begin, p, new_begin);
+        new_end = std::uninitialized_copy(first, last, new_end);
+        new_end = std::uninitialized_copy(p, _end, new_end);
+      } catch (...) {
+        _destroy_range(new_begin, new_end);
+        _alloc.deallocate(new_begin, new_cap);
+        throw;
+      }
+      _replace_storage(new_begin, new_end, new_cap);
+      return;
+    }
+    // BASIC
+    pointer old_end = _end;
+    const size_type elems_after = old_end - p;
+    if (elems_after > n) {
+      _end = std::uninitialized_copy(old_end - n, old_end, old_end);
+      std::copy_backward(p, old_end - n, old_end);
+      std::copy(first, last, p);
+    } else {
+      ForwardIterator mid = first;
+      std::advance(mid, elems_after);
+      _end = std::uninitialized_copy(mid, last, old_end);
+      _end = std::uninitialized_copy(p, old_end, _end);
+      std::copy(first, mid, p);
+    }
+  }
+
+  // NOTHROW removed elements include the last element
+  // BASIC otherwise
+  iterator erase(iterator position) { return erase(position, position + 1); }
+
+  iterator erase(iterator first, iterator last) {
+    pointer first_p = _begin + (first - begin());
+    pointer last_p = _begin + (last - begin());
+    if (first_p != last_p) {
+      _destroy_at_end(std::copy(last_p, _end, first_p));
+    }
+    return iterator(first_p);
+  }
+
+  // NOTHROW both are on the heap
+  // BASIC otherwise
+  /**
+   * @brief 둘 다 heap 에 있으면 pointer 만 바꾼다. 하나라도 inline 이면
+   * element 를 복사해서 바꾼다.
+   */
+  void swap(small_vector& x) {
+    if (this == &x) {
+      return;
+    }
+    if (!is_inline() && !x.is_inline()) {
+      ft::swap(_begin, x._begin);
+      ft::swap(_end, x._end);
+      ft::swap(_end_cap, x._end_cap);
+      return;
+    }
+    small_vector tmp(*this);
+    *this = x;
+    x = tmp;
+  }
+
+  // NOTHROW
+  void clear(void) { _destroy_at_end(_begin); }
+  // !SECTION: modifiers
+
+  allocator_type get_allocator(void) const { return _alloc; }
+
+  // SECTION: private functions
+ private:
+  pointer _inline_begin(void) {
+    return reinterpret_cast<pointer>(_storage.bytes);
+  }
+  const_pointer _inline_begin(void) const {
+    return reinterpret_cast<const_pointer>(_storage.bytes);
+  }
+
+  size_type _get_alloc_size(size_type new_size) const {
+    const size_type _max_size = max_size();
+    if (new_size > _max_size) {
+      throw std::length_error(
+          "ft::small_vector : reallocation size is too big");
+    }
+    const size_type cap = capacity();
+    if (cap >= _max_size / 2) {
+      return _max_size;
+    }
+    return max(2 * cap, new_size);
+  }
+
+  /**
+   * @brief 비어 있는 상태에서 n 개를 담을 수 있도록 heap 을 준비한다.
+   * constructor 에서만 사용한다.
+   */
+  void _reserve_empty(size_type n) {
+    if (n > N) {
+      _begin = _end = _alloc.allocate(n);
+      _end_cap = _begin + n;
+    }
+  }
+
+  /**
+   * @brief element 들을 new_cap 크기의 heap block 으로 옮긴다.
+   * 복사에 실패하면 기존 storage 는 그대로다. (STRONG)
+   */
+  void _reallocate(size_type new_cap) {
+    pointer new_begin = _alloc.allocate(new_cap);
+    pointer new_end;
+    try {
+      new_end = std::uninitialized_copy(_begin, _end, new_begin);
+    } catch (...) {
+      _alloc.deallocate(new_begin, new_cap);
+      throw;
+    }
+    _replace_storage(new_begin, new_end, new_cap);
+  }
+
+  /**
+   * @brief 기존 element 를 destroy 하고 새 heap block 을 storage 로 삼는다.
+   */
+  void _replace_storage(pointer new_begin, pointer new_end, size_type new_cap) {
+    _release();
+    _begin = new_begin;
+    _end = new_end;
+    _end_cap = new_begin + new_cap;
+  }
+
+  /**
+   * @brief 모든 element 를 destroy 하고 heap 에 있었다면 block 을 해제한다.
+   */
+  void _release(void) {
+    _destroy_range(_begin, _end);
+    if (!is_inline()) {
+      _alloc.deallocate(_begin, capacity());
+    }
+  }
+
+  void _construct_at_end(size_type n, const value_type& val) {
+    pointer old_end = _end;
+    try {
+      for (size_type idx = 0; idx < n; ++idx) {
+        _alloc.construct(_end, val);
+        ++_end;
+      }
+    } catch (...) {
+      _destroy_at_end(old_end);  // rollback
+      throw;
+    }
+  }
+
+  void _destroy_at_end(pointer pos) {
+    _destroy_range(pos, _end);
+    _end = pos;
+  }
+
+  void _destroy_range(pointer first, pointer last) {
+    if (!is_trivially_destructible<value_type>::value) {
+      for (; first != last; ++first) {
+        _alloc.destroy(first);
+      }
+    }
+  }
+  // !SECTION: private functions
+};
+
+// SECTION: non-member function of small_vector
+template <typename T, size_t N, typename Alloc>
+bool operator==(const small_vector<T, N, Alloc>& lhs,
+                const small_vector<T, N, Alloc>& rhs) {
+  return (lhs.size() == rhs.size()) &&
+         equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, size_t N, typename Alloc>
+bool operator!=(const small_vector<T, N, Alloc>& lhs,
+                const small_vector<T, N, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T, size_t N, typename Alloc>
+bool operator<(const small_vector<T, N, Alloc>& lhs,
+               const small_vector<T, N, Alloc>& rhs) {
+  return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                 rhs.end());
+}
+
+template <typename T, size_t N, typename Alloc>
+bool operator>(const small_vector<T, N, Alloc>& lhs,
+               const small_vector<T, N, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T, size_t N, typename Alloc>
+bool operator<=(const small_vector<T, N, Alloc>& lhs,
+                const small_vector<T, N, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T, size_t N, typename Alloc>
+bool operator>=(const small_vector<T, N, Alloc>& lhs,
+                const small_vector<T, N, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <typename T, size_t N, typename Alloc>
+void swap(small_vector<T, N, Alloc>& x, small_vector<T, N, Alloc>& y) {
+  x.swap(y);
+}
+// !SECTION: non-member function of small_vector
+// !SECTION: small_vector
+}  // namespace ft
+
+#endif  // SMALL_VECTOR_HPP
@@ -0,0 +1,789 @@
+/**
+ * @file soa_vector.hpp
+ * @author jiskim
+ * @brief structure-of-arrays vector
+ * @date 2023-02-27
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <stdexcept>  // out_of_range
+
+#include "vector.hpp"
+
+namespace ft {
+
+// SECTION: soa field list
+/**
+ * @brief soa_vector 의 사용하지 않는 field 자리. C++98 에는 variadic
+ * template 이 없으므로 field 는 최대 8 개까지 default template argument
+ * 로 받는다.
+ */
+struct _soa_none {};
+
+/**
+ * @brief field list 의 끝. 어떤 argument 로 생성해도 무시한다.
+ */
+struct _soa_nil {
+  _soa_nil(void) {}
+
+  template <typename A0, typename A1, typename A2, typename A3, typename A4,
+            typename A5, typename A6, typename A7>
+  _soa_nil(const A0&, const A1&, const A2&, const A3&, const A4&, const A5&,
+           const A6&, const A7&) {}
+};
+
+inline bool operator==(const _soa_nil&, const _soa_nil&) { return true; }
+
+inline bool operator<(const _soa_nil&, const _soa_nil&) { return false; }
+
+/**
+ * @brief field 하나와 나머지 field 의 list. soa_vector 의 한 row 값이다.
+ */
+template <typename Head, typename Tail>
+struct _soa_node {
+  typedef Head head_type;
+  typedef Tail tail_type;
+
+  Head head;
+  Tail tail;
+
+  _soa_node(void) : head(), tail() {}
+
+  // argument 를 하나씩 밀어서 나머지 field 에 넘긴다.
+  template <typename A1, typename A2, typename A3, typename A4, typename A5,
+            typename A6, typename A7>
+  _soa_node(const Head& a0, const A1& a1, const A2& a2, const A3& a3,
+            const A4& a4, const A5& a5, const A6& a6, const A7& a7)
+      : head(a0), tail(a1, a2, a3, a4, a5, a6, a7, _soa_none()) {}
+};
+
+template <typename Head, typename Tail>
+bool operator==(const _soa_node<Head, Tail>& lhs,
+                const _soa_node<Head, Tail>& rhs) {
+  return lhs.head == rhs.head && lhs.tail == rhs.tail;
+}
+
+template <typename Head, typename Tail>
+bool operator<(const _soa_node<Head, Tail>& lhs,
+               const _soa_node<Head, Tail>& rhs) {
+  if (lhs.head < rhs.head) {
+    return true;
+  }
+  if (rhs.head < lhs.head) {
+    return false;
+  }
+  return lhs.tail < rhs.tail;
+}
+
+/**
+ * @brief T0 ... T7 에서 첫 _soa_none 앞까지의 field 로 list 를 만든다.
+ */
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+struct _soa_list {
+  typedef _soa_node<T0, typename _soa_list<T1, T2, T3, T4, T5, T6, T7,
+                                           _soa_none>::type>
+      type;
+};
+
+template <typename T1, typename T2, typename T3, typename T4, typename T5,
+          typename T6, typename T7>
+struct _soa_list<_soa_none, T1, T2, T3, T4, T5, T6, T7> {
+  typedef _soa_nil type;
+};
+
+template <typename List>
+struct _soa_length {
+  static const size_t value =
+      1 + _soa_length<typename List::tail_type>::value;
+};
+
+template <>
+struct _soa_length<_soa_nil> {
+  static const size_t value = 0;
+};
+
+/**
+ * @brief list (row 또는 column) 의 I 번째 head.
+ */
+template <size_t I, typename List>
+struct _soa_at {
+  typedef _soa_at<I - 1, typename List::tail_type> _next;
+  typedef typename _next::type type;
+
+  static type& get(List& list) { return _next::get(list.tail); }
+  static const type& get(const List& list) { return _next::get(list.tail); }
+};
+
+template <typename List>
+struct _soa_at<0, List> {
+  typedef typename List::head_type type;
+
+  static type& get(List& list) { return list.head; }
+  static const type& get(const List& list) { return list.head; }
+};
+
+/**
+ * @brief soa_vector 의 value_type. field 를 순서대로 생성자에 넘기고
+ * get<I>() 로 꺼낸다.
+ */
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+struct _soa_row
+    : public _soa_list<T0, T1, T2, T3, T4, T5, T6, T7>::type {
+  typedef typename _soa_list<T0, T1, T2, T3, T4, T5, T6, T7>::type list_type;
+
+  _soa_row(void) : list_type() {}
+
+  explicit _soa_row(const T0& a0, const T1& a1 = T1(), const T2& a2 = T2(),
+                    const T3& a3 = T3(), const T4& a4 = T4(),
+                    const T5& a5 = T5(), const T6& a6 = T6(),
+                    const T7& a7 = T7())
+      : list_type(a0, a1, a2, a3, a4, a5, a6, a7) {}
+
+  template <size_t I>
+  typename _soa_at<I, list_type>::type& get(void) {
+    return _soa_at<I, list_type>::get(*this);
+  }
+
+  template <size_t I>
+  const typename _soa_at<I, list_type>::type& get(void) const {
+    return _soa_at<I, list_type>::get(*this);
+  }
+};
+// !SECTION: soa field list
+
+// SECTION: soa columns
+/**
+ * @brief field 마다 하나씩 있는 ft::vector 의 list. 모든 column 의 size
+ * 는 항상 같다. 여러 column 을 바꾸는 연산은 뒤 column 에서 예외가 나면
+ * 앞 column 을 되돌린다.
+ */
+template <typename List>
+struct _soa_columns;
+
+template <>
+struct _soa_columns<_soa_nil> {
+  void load(size_t, _soa_nil&) const {}
+  void store(size_t, const _soa_nil&) {}
+  void push_back(const _soa_nil&) {}
+  void pop_back(void) {}
+  void resize(size_t, const _soa_nil&) {}
+  void reserve(size_t) {}
+  void shrink_to_fit(void) {}
+  void insert(size_t, size_t, const _soa_nil&) {}
+  void insert(size_t, const _soa_columns&) {}
+  void erase(size_t, size_t) {}
+  void clear(void) {}
+  void swap(_soa_columns&) {}
+
+  size_t capacity(void) const { return static_cast<size_t>(-1); }
+  size_t max_size(void) const { return static_cast<size_t>(-1); }
+
+  bool equal(const _soa_columns&) const { return true; }
+};
+
+template <typename Head, typename Tail>
+struct _soa_columns<_soa_node<Head, Tail> > {
+  typedef vector<Head> head_type;
+  typedef _soa_columns<Tail> tail_type;
+  typedef _soa_node<Head, Tail> row_type;
+
+  head_type head;
+  tail_type tail;
+
+  size_t size(void) const { return head.size(); }
+
+  void load(size_t i, row_type& out) const {
+    out.head = head[i];
+    tail.load(i, out.tail);
+  }
+
+  // BASIC
+  void store(size_t i, const row_type& in) {
+    head[i] = in.head;
+    tail.store(i, in.tail);
+  }
+
+  // STRONG
+  void push_back(const row_type& in) {
+    head.push_back(in.head);
+    try {
+      tail.push_back(in.tail);
+    } catch (...) {
+      head.pop_back();
+      throw;
+    }
+  }
+
+  // NOTHROW
+  void pop_back(void) {
+    head.pop_back();
+    tail.pop_back();
+  }
+
+  // STRONG n > size
+  // BASIC otherwise
+  void resize(size_t n, const row_type& val) {
+    const size_t old = head.size();
+    head.resize(n, val.head);
+    try {
+      tail.resize(n, val.tail);
+    } catch (...) {
+      if (n > old) {
+        head.erase(head.begin() + old, head.end());
+      }
+      throw;
+    }
+  }
+
+  // STRONG
+  void reserve(size_t n) {
+    head.reserve(n);
+    tail.reserve(n);
+  }
+
+  // STRONG
+  void shrink_to_fit(void) {
+    head.shrink_to_fit();
+    tail.shrink_to_fit();
+  }
+
+  // BASIC
+  void insert(size_t pos, size_t n, const row_type& val) {
+    head.insert(head.begin() + pos, n, val.head);
+    try {
+      tail.insert(pos, n, val.tail);
+    } catch (...) {
+      head.erase(head.begin() + pos, head.begin() + pos + n);
+      throw;
+    }
+  }
+
+  // BASIC
+  void insert(size_t pos, const _soa_columns& src) {
+    head.insert(head.begin() + pos, src.head.begin(), src.head.end());
+    try {
+      tail.insert(pos, src.tail);
+    } catch (...) {
+      head.erase(head.begin() + pos, head.begin() + pos + src.head.size());
+      throw;
+    }
+  }
+
+  // BASIC
+  void erase(size_t first, size_t last) {
+    head.erase(head.begin() + first, head.begin() + last);
+    tail.erase(first, last);
+  }
+
+  // NOTHROW
+  void clear(void) {
+    head.clear();
+    tail.clear();
+  }
+
+  // NOTHROW
+  void swap(_soa_columns& x) {
+    head.swap(x.head);
+    tail.swap(x.tail);
+  }
+
+  size_t capacity(void) const {
+    return ft::min(head.capacity(), tail.capacity());
+  }
+
+  size_t max_size(void) const {
+    return ft::min(head.max_size(), tail.max_size());
+  }
+
+  bool equal(const _soa_columns& x) const {
+    return head.size() == x.head.size() &&
+           ft::equal(head.begin(), head.end(), x.head.begin()) &&
+           tail.equal(x.tail);
+  }
+};
+
+/**
+ * @brief I 번째 field 의 element 에 대한 reference type. Columns 가 const
+ * 면 const reference.
+ */
+template <size_t I, typename Columns>
+struct _soa_field {
+  typedef typename _soa_at<I, Columns>::type::value_type value_type;
+  typedef value_type& reference;
+};
+
+template <size_t I, typename Columns>
+struct _soa_field<I, const Columns> {
+  typedef typename _soa_at<I, Columns>::type::value_type value_type;
+  typedef const value_type& reference;
+};
+// !SECTION: soa columns
+
+// SECTION: soa reference
+/**
+ * @brief soa_vector 의 row 하나를 가리키는 proxy. get<I>() 로 field 하나
+ * 에 접근하면 그 column 만 읽는다. Row 로 변환되고 Row 를 대입할 수 있다.
+ *
+ * @tparam Row soa_vector 의 value_type
+ * @tparam Columns const 면 const_reference
+ */
+template <typename Row, typename Columns>
+struct _soa_reference {
+  Columns* _cols;
+  size_t _i;
+
+  _soa_reference(Columns* cols, size_t i) : _cols(cols), _i(i) {}
+
+  template <size_t I>
+  typename _soa_field<I, Columns>::reference get(void) const {
+    return _soa_at<I, typename remove_cv<Columns>::type>::get(*_cols)[_i];
+  }
+
+  operator Row(void) const {
+    Row row;
+    _cols->load(_i, row);
+    return row;
+  }
+
+  const _soa_reference& operator=(const Row& x) const {
+    _cols->store(_i, x);
+    return *this;
+  }
+
+  // 가리키는 row 가 아니라 값을 대입한다.
+  const _soa_reference& operator=(const _soa_reference& x) const {
+    return *this = static_cast<Row>(x);
+  }
+
+  bool operator==(const _soa_reference& x) const {
+    return static_cast<Row>(*this) == static_cast<Row>(x);
+  }
+
+  bool operator<(const _soa_reference& x) const {
+    return static_cast<Row>(*this) < static_cast<Row>(x);
+  }
+};
+
+/**
+ * @brief proxy 가 가리키는 두 row 의 값을 바꾼다.
+ * ft::swap(T&, T&) 는 proxy 자체를 바꾸므로 따로 정의한다.
+ */
+template <typename Row, typename Columns>
+void swap(_soa_reference<Row, Columns> x, _soa_reference<Row, Columns> y) {
+  Row tmp = x;
+  x = y;
+  y = tmp;
+}
+// !SECTION: soa reference
+
+// SECTION: soa iterator
+/**
+ * @brief column list 와 row index 로 row 하나를 가리킨다. Columns 가
+ * const 면 const_iterator.
+ */
+template <typename Row, typename Columns>
+struct _soa_iterator {
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef Row value_type;
+  typedef ptrdiff_t difference_type;
+  typedef _soa_reference<Row, Columns> reference;
+  typedef reference* pointer;
+  typedef _soa_iterator self;
+
+  Columns* _cols;
+  difference_type _i;
+
+  _soa_iterator(void) : _cols(NULL), _i(0) {}
+  _soa_iterator(Columns* cols, difference_type i) : _cols(cols), _i(i) {}
+
+  // iterator 에서 const_iterator 로 변환
+  template <typename Other>
+  _soa_iterator(const _soa_iterator<Row, Other>& it)
+      : _cols(it._cols), _i(it._i) {}
+
+  reference operator*(void) const {
+    return reference(_cols, static_cast<size_t>(_i));
+  }
+
+  self& operator++(void) {
+    ++_i;
+    return *this;
+  }
+  self operator++(int) {
+    self tmp = *this;
+    ++_i;
+    return tmp;
+  }
+
+  self& operator--(void) {
+    --_i;
+    return *this;
+  }
+  self operator--(int) {
+    self tmp = *this;
+    --_i;
+    return tmp;
+  }
+
+  self& operator+=(difference_type n) {
+    _i += n;
+    return *this;
+  }
+  self& operator-=(difference_type n) {
+    _i -= n;
+    return *this;
+  }
+
+  self operator+(difference_type n) const { return self(_cols, _i + n); }
+  self operator-(difference_type n) const { return self(_cols, _i - n); }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+};
+
+template <typename Row, typename C>
+_soa_iterator<Row, C> operator+(ptrdiff_t n, const _soa_iterator<Row, C>& it) {
+  return it + n;
+}
+
+template <typename Row, typename C1, typename C2>
+ptrdiff_t operator-(const _soa_iterator<Row, C1>& lhs,
+                    const _soa_iterator<Row, C2>& rhs) {
+  return lhs._i - rhs._i;
+}
+
+template <typename Row, typename C1, typename C2>
+bool operator==(const _soa_iterator<Row, C1>& lhs,
+                const _soa_iterator<Row, C2>& rhs) {
+  return lhs._i == rhs._i;
+}
+
+template <typename Row, typename C1, typename C2>
+bool operator!=(const _soa_iterator<Row, C1>& lhs,
+                const _soa_iterator<Row, C2>& rhs) {
+  return lhs._i != rhs._i;
+}
+
+template <typename Row, typename C1, typename C2>
+bool operator<(const _soa_iterator<Row, C1>& lhs,
+               const _soa_iterator<Row, C2>& rhs) {
+  return lhs._i < rhs._i;
+}
+
+template <typename Row, typename C1, typename C2>
+bool operator>(const _soa_iterator<Row, C1>& lhs,
+               const _soa_iterator<Row, C2>& rhs) {
+  return lhs._i > rhs._i;
+}
+
+template <typename Row, typename C1, typename C2>
+bool operator<=(const _soa_iterator<Row, C1>& lhs,
+                const _soa_iterator<Row, C2>& rhs) {
+  return lhs._i <= rhs._i;
+}
+
+template <typename Row, typename C1, typename C2>
+bool operator>=(const _soa_iterator<Row, C1>& lhs,
+                const _soa_iterator<Row, C2>& rhs) {
+  return lhs._i >= rhs._i;
+}
+// !SECTION: soa iterator
+
+// SECTION: soa_vector
+/**
+ * @brief record 의 field 마다 따로 contiguous 한 ft::vector 에 저장하는
+ * vector. field 하나만 읽는 scan 은 그 field 의 column 만 cache 로
+ * 가져온다.
+ *
+ * ft::soa_vector<int, float, double> v;
+ * v.push_back(ft::soa_vector<int, float, double>::value_type(1, 2.f, 3.));
+ * v[0].get<1>() = 4.f;
+ * const float* ys = v.data<1>();
+ *
+ * element 는 proxy (reference) 로 접근하므로 &v[0] 으로 record 의 pointer
+ * 를 얻을 수 없다. field 는 최대 8 개이고 ft::vector 의 element 가 될 수
+ * 있어야 한다. (char[16] 같은 배열은 struct 로 감싼다.)
+ *
+ * @tparam T0 ... T7 field type
+ */
+template <typename T0, typename T1 = _soa_none, typename T2 = _soa_none,
+          typename T3 = _soa_none, typename T4 = _soa_none,
+          typename T5 = _soa_none, typename T6 = _soa_none,
+          typename T7 = _soa_none>
+class soa_vector {
+ public:
+  typedef _soa_row<T0, T1, T2, T3, T4, T5, T6, T7> value_type;
+
+ private:
+  typedef typename value_type::list_type _list;
+  typedef _soa_columns<_list> _columns;
+
+ public:
+  typedef _soa_reference<value_type, _columns> reference;
+  typedef _soa_reference<value_type, const _columns> const_reference;
+  typedef reference* pointer;
+  typedef const_reference* const_pointer;
+
+  typedef _soa_iterator<value_type, _columns> iterator;
+  typedef _soa_iterator<value_type, const _columns> const_iterator;
+
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+  // field 의 수
+  static const size_type fields = _soa_length<_list>::value;
+
+  /**
+   * @brief I 번째 field 의 type
+   */
+  template <size_t I>
+  struct field {
+    typedef typename _soa_at<I, _list>::type type;
+  };
+
+ private:
+  _columns _cols;
+
+ public:
+  // SECTION: constructor and destructor
+  soa_vector(void) {}
+
+  // STRONG
+  explicit soa_vector(size_type n, const value_type& val = value_type()) {
+    _cols.resize(n, val);
+  }
+
+  // STRONG
+  template <typename InputIterator>
+  soa_vector(InputIterator first,
+             typename enable_if<is_input_iterator<InputIterator>::value,
+                                InputIterator>::type last) {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  // NOTHROW
+  ~soa_vector(void) {}
+  // !SECTION: constructor and destructor
+
+  // SECTION: iterator
+  iterator begin(void) { return iterator(&_cols, 0); }
+  const_iterator begin(void) const { return const_iterator(&_cols, 0); }
+
+  iterator end(void) { return begin() + static_cast<difference_type>(size()); }
+  const_iterator end(void) const {
+    return begin() + static_cast<difference_type>(size());
+  }
+
+  reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin(void) const {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend(void) { return reverse_iterator(begin()); }
+  const_reverse_iterator rend(void) const {
+    return const_reverse_iterator(begin());
+  }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return _cols.size(); }
+
+  size_type max_size(void) const { return _cols.max_size(); }
+
+  // STRONG n > size
+  // BASIC otherwise
+  void resize(size_type n, const value_type& val = value_type()) {
+    _cols.resize(n, val);
+  }
+
+  /**
+   * @brief 모든 column 이 재할당 없이 담을 수 있는 row 의 수
+   */
+  size_type capacity(void) const { return _cols.capacity(); }
+
+  bool empty(void) const { return size() == 0; }
+
+  // STRONG
+  void reserve(size_type n) { _cols.reserve(n); }
+
+  // STRONG
+  void shrink_to_fit(void) { _cols.shrink_to_fit(); }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  // NOTHROW size > n
+  // otherwise UB
+  reference operator[](size_type n) { return reference(&_cols, n); }
+  const_reference operator[](size_type n) const {
+    return const_reference(&_cols, n);
+  }
+
+  // STRONG
+  reference at(size_type n) {
+    if (n >= size()) {
+      throw std::out_of_range("ft::soa_vector::at n is out of range.");
+    }
+    return (*this)[n];
+  }
+  const_reference at(size_type n) const {
+    if (n >= size()) {
+      throw std::out_of_range("ft::soa_vector::at n is out of range.");
+    }
+    return (*this)[n];
+  }
+
+  reference front(void) { return (*this)[0]; }
+  const_reference front(void) const { return (*this)[0]; }
+
+  reference back(void) { return (*this)[size() - 1]; }
+  const_reference back(void) const { return (*this)[size() - 1]; }
+
+  /**
+   * @brief I 번째 field 의 column. size() 개의 element 가 연속해 있으므로
+   * SIMD kernel 에 그대로 넘길 수 있다.
+   */
+  template <size_t I>
+  typename field<I>::type* data(void) {
+    return _soa_at<I, _columns>::get(_cols).data();
+  }
+
+  template <size_t I>
+  const typename field<I>::type* data(void) const {
+    return _soa_at<I, _columns>::get(_cols).data();
+  }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // STRONG
+  template <typename InputIterator>
+  void assign(InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    soa_vector(first, last).swap(*this);
+  }
+
+  // STRONG
+  void assign(size_type n, const value_type& val) {
+    soa_vector(n, val).swap(*this);
+  }
+
+  // STRONG
+  void push_back(const value_type& val) { _cols.push_back(val); }
+
+  // NOTHROW
+  void pop_back(void) { _cols.pop_back(); }
+
+  // BASIC
+  iterator insert(iterator position, const value_type& val) {
+    _cols.insert(static_cast<size_type>(position._i), 1, val);
+    return position;
+  }
+
+  // BASIC
+  void insert(iterator position, size_type n, const value_type& val) {
+    _cols.insert(static_cast<size_type>(position._i), n, val);
+  }
+
+  // BASIC
+  /**
+   * @brief range 를 임시 soa_vector 로 column 별로 나눈 뒤 column 마다
+   * 한 번에 insert 한다.
+   */
+  template <typename InputIterator>
+  void insert(iterator position, InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    const soa_vector tmp(first, last);
+    _cols.insert(static_cast<size_type>(position._i), tmp._cols);
+  }
+
+  // BASIC
+  iterator erase(iterator position) { return erase(position, position + 1); }
+
+  // BASIC
+  iterator erase(iterator first, iterator last) {
+    _cols.erase(static_cast<size_type>(first._i),
+                static_cast<size_type>(last._i));
+    return first;
+  }
+
+  // NOTHROW
+  void swap(soa_vector& x) { _cols.swap(x._cols); }
+
+  // NOTHROW
+  void clear(void) { _cols.clear(); }
+  // !SECTION: modifiers
+
+  // column 별로 비교한다.
+  bool _equal(const soa_vector& x) const { return _cols.equal(x._cols); }
+};
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+const typename soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>::size_type
+    soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>::fields;
+
+// SECTION: non-member function of soa_vector
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+bool operator==(const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& lhs,
+                const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& rhs) {
+  return lhs._equal(rhs);
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+bool operator!=(const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& lhs,
+                const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+bool operator<(const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& lhs,
+               const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+bool operator>(const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& lhs,
+               const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& rhs) {
+  return rhs < lhs;
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+bool operator<=(const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& lhs,
+                const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+bool operator>=(const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& lhs,
+                const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7>
+void swap(soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& x,
+          soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& y) {
+  x.swap(y);
+}
+// !SECTION: non-member function of soa_vector
+// !SECTION: soa_vector
+}  // namespace ft
+
+#endif  // SOA_VECTOR_HPP
@@ -29,13 +29,22 @@ class stack {
  public:
   explicit stack(const container_type& ctnr = container_type()) : c(ctnr) {}
 
+#if FT_HAS_MOVE
+  explicit stack(container_type&& ctnr) : c(std::move(ctnr)) {}
+
+  stack(const stack&) = default;
+  stack(stack&&) = default;
+  stack& operator=(const stack&) = default;
+  stack& operator=(stack&&) = default;
+#endif
+
   bool empty(void) const { return c.empty(); }
 
   size_type size(void) const { return c.size(); }
 
-  value_type& top(void) { return c.back(); }
+  reference top(void) { return c.back(); }
 
-  const value_type& top(void) const { return c.back(); }
+  const_reference top(void) const { return c.back(); }
 
   void push(const value_type& val) { c.push_back(val); }
 
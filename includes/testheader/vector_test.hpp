@@ -35,5 +35,14 @@ void type_traits_test(void);
 void vector_test(void);
 void std_vector_test(void);
 void pair_test(void);
+void vector_bool_test(void);
+void small_vector_test(void);
+void incremental_vector_test(void);
+void deque_test(void);
+void concurrent_vector_test(void);
+void mapped_vector_test(void);
+void cow_vector_test(void);
+void soa_vector_test(void);
+void packed_vector_test(void);
 
 #endif
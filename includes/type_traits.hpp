@@ -12,6 +12,15 @@
 
 #include "iterator.hpp"
 
+// C++11 이상으로 컴파일하면 container 들이 move 생성자와 move 대입을 제공한다.
+#if __cplusplus >= 201103L
+#define FT_HAS_MOVE 1
+#include <type_traits>  // std::is_nothrow_move_constructible
+#include <utility>      // std::move
+#else
+#define FT_HAS_MOVE 0
+#endif
+
 namespace ft {
 
 // SECTION: enable_if
@@ -130,6 +139,173 @@ template <typename T>
 struct is_integral : public _is_integral<typename remove_cv<T>::type> {};
 // !SECTION: is_integral
 
+// SECTION: is_same
+template <typename T, typename U>
+struct is_same : public false_type {};
+
+template <typename T>
+struct is_same<T, T> : public true_type {};
+// !SECTION: is_same
+
+// SECTION: is_arithmetic
+template <typename T>
+struct _is_floating_point : public false_type {};
+
+template <>
+struct _is_floating_point<float> : public true_type {};
+
+template <>
+struct _is_floating_point<double> : public true_type {};
+
+template <>
+struct _is_floating_point<long double> : public true_type {};
+
+template <typename T>
+struct is_floating_point
+    : public _is_floating_point<typename remove_cv<T>::type> {};
+
+/**
+ * @brief integral 또는 floating point 이면 true_type.
+ *
+ * @tparam T
+ */
+template <typename T>
+struct is_arithmetic
+    : public integral_constant<bool, is_integral<T>::value ||
+                                         is_floating_point<T>::value> {};
+// !SECTION: is_arithmetic
+
+// SECTION: is_pointer
+template <typename T>
+struct _is_pointer : public false_type {};
+
+template <typename T>
+struct _is_pointer<T *> : public true_type {};
+
+template <typename T>
+struct is_pointer : public _is_pointer<typename remove_cv<T>::type> {};
+// !SECTION: is_pointer
+
+// SECTION: is_trivially_copyable, is_trivially_destructible
+/**
+ * @brief 컴파일러 intrinsic 을 쓸 수 있으면 그 결과를, 아니면 arithmetic 과
+ * pointer 만 trivial 로 판별한다.
+ * c++98 에는 표준 trait 이 없으므로 gcc, clang 의 builtin 을 사용한다.
+ *
+ * @tparam T
+ */
+template <typename T>
+struct _is_trivially_copyable
+    : public integral_constant<bool,
+#if defined(__GNUC__) || defined(__clang__)
+                               __is_trivially_copyable(T)
+#else
+                               is_arithmetic<T>::value ||
+                                   is_pointer<T>::value
+#endif
+                               > {
+};
+
+template <typename T>
+struct _is_trivially_destructible
+    : public integral_constant<bool,
+#if defined(__clang__)
+                               __is_trivially_destructible(T)
+#elif defined(__GNUC__)
+                               __has_trivial_destructor(T)
+#else
+                               is_arithmetic<T>::value ||
+                                   is_pointer<T>::value
+#endif
+                               > {
+};
+
+template <typename T>
+struct _is_trivially_default_constructible
+    : public integral_constant<bool,
+#if defined(__clang__)
+                               __is_trivially_constructible(T)
+#elif defined(__GNUC__)
+                               __has_trivial_constructor(T)
+#else
+                               is_arithmetic<T>::value ||
+                                   is_pointer<T>::value
+#endif
+                               > {
+};
+
+/**
+ * @brief memcpy, memmove 로 복사해도 되는 타입인지 판별한다.
+ * intrinsic 이 없는 컴파일러이거나 판별이 보수적인 경우, 사용자는 자신의
+ * POD 타입에 대해 직접 특수화 할 수 있다.
+ *
+ * struct Record { int id; char name[16]; };
+ * namespace ft {
+ * template <> struct is_trivially_copyable<Record> : public true_type {};
+ * }
+ *
+ * @tparam T
+ */
+template <typename T>
+struct is_trivially_copyable
+    : public _is_trivially_copyable<typename remove_cv<T>::type> {};
+
+/**
+ * @brief destructor 호출을 생략해도 되는 타입인지 판별한다.
+ * is_trivially_copyable 과 마찬가지로 사용자가 특수화 할 수 있다.
+ *
+ * @tparam T
+ */
+template <typename T>
+struct is_trivially_destructible
+    : public _is_trivially_destructible<typename remove_cv<T>::type> {};
+
+/**
+ * @brief default initialization 이 아무 일도 하지 않는 (값이 정해지지 않는)
+ * 타입인지 판별한다. 사용자가 특수화 할 수 있다.
+ *
+ * @tparam T
+ */
+template <typename T>
+struct is_trivially_default_constructible
+    : public _is_trivially_default_constructible<
+          typename remove_cv<T>::type> {};
+// !SECTION: is_trivially_copyable, is_trivially_destructible
+
+// SECTION: is_trivially_relocatable
+/**
+ * @brief object 를 memcpy 로 다른 주소에 옮기고 원본의 destructor 를 부르지
+ * 않아도 되는 타입인지 판별한다. (realloc, mremap 으로 block 째 이동)
+ * 기본값은 is_trivially_copyable 이고, 자기 주소를 가리키는 포인터가 없는
+ * 타입은 사용자가 opt-in 할 수 있다.
+ *
+ * namespace ft {
+ * template <> struct is_trivially_relocatable<Handle> : public true_type {};
+ * }
+ *
+ * @tparam T
+ */
+template <typename T>
+struct is_trivially_relocatable : public is_trivially_copyable<T> {};
+// !SECTION: is_trivially_relocatable
+
+// SECTION: is_swap_relocatable
+/**
+ * @brief default 생성한 object 와 member swap 을 해서 옮겨도 되는 타입인지
+ * 판별한다. default 생성자와 swap 이 O(1) 이고 예외를 던지지 않아야 한다.
+ * ft::vector, ft::map, ft::set 은 특수화 되어 있고 (기본 allocator 처럼
+ * 상태가 없는 allocator 기준) 사용자가 opt-in 할 수 있다.
+ *
+ * namespace ft {
+ * template <> struct is_swap_relocatable<Index> : public true_type {};
+ * }
+ *
+ * @tparam T
+ */
+template <typename T>
+struct is_swap_relocatable : public false_type {};
+// !SECTION: is_swap_relocatable
+
 // SECTION: is_*_iterator
 
 template <typename Base, typename Derived>
@@ -10,9 +10,20 @@
 #ifndef VECTOR_HPP
 #define VECTOR_HPP
 
-#include <memory>  // std::allocator, stdexcept(std::out_of_range)
+#include <sys/uio.h>  // writev
+#include <unistd.h>   // read
+
+#include <algorithm>  // std::rotate
+#include <cerrno>     // errno, EINTR
+#include <cstring>    // memmove, memset
+#include <memory>     // std::allocator, stdexcept(std::out_of_range)
+#include <new>        // placement new
+#include <stdexcept>  // invalid_argument
 
 #include "algorithm.hpp"
+#include "growth_policy.hpp"
+#include "memory.hpp"
+#include "parallel.hpp"
 #include "reverse_iterator.hpp"
 #include "type_traits.hpp"
 
@@ -153,22 +164,132 @@ class vector_base {
       : _alloc(allocator),
         _begin(_alloc.allocate(n)),
         _end(_begin),
-        _end_cap(_begin + n) {}
+        _end_cap(_begin + _usable_size(_begin, n)) {}
+
+#if FT_HAS_MOVE
+  // x 의 storage 를 그대로 가져오고 x 는 빈 상태로 남긴다.
+  vector_base(vector_base&& x) noexcept
+      : _alloc(x._alloc), _begin(x._begin), _end(x._end), _end_cap(x._end_cap) {
+    x._begin = x._end = x._end_cap = NULL;
+  }
+#endif
+
+  /**
+   * @brief 모든 byte 가 0 인 n 개 크기의 storage 를 할당한다.
+   * allocator 가 allocate_zeroed 를 제공하면 (calloc, anonymous mmap) kernel
+   * 이 준 0 page 를 그대로 쓰고, 아니면 memset 한다.
+   * _begin 이 비어있을 때만 호출해야 한다.
+   *
+   * @param n 할당할 element 의 개수
+   */
+  void _allocate_zeroed(typename allocator_type::size_type n) {
+    _begin = _end = _zeroed_block(n, _has_allocate_zeroed<allocator_type>());
+    _end_cap = _begin + _usable_size(_begin, n);
+  }
+
+  /**
+   * @brief n 개로 할당한 block p 에 실제로 들어가는 element 의 수.
+   * allocator 가 usable_size 를 제공하면 malloc size class 나 page 올림으로
+   * 생긴 여유분까지 capacity 로 잡아서 다음 재할당을 늦춘다.
+   * 여유분은 0 으로 채워졌다고 가정하지 않는다.
+   */
+  typename allocator_type::size_type _usable_size(
+      pointer p, typename allocator_type::size_type n) const {
+    return _usable_size(p, n, _has_usable_size<allocator_type>());
+  }
 
   ~vector_base(void) {
-    for (pointer tmp = _begin; tmp != _end; ++tmp) {
-      _alloc.destroy(tmp);
+    if (!is_trivially_destructible<T>::value) {
+      for (pointer tmp = _begin; tmp != _end; ++tmp) {
+        _alloc.destroy(tmp);
+      }
     }
     _alloc.deallocate(_begin, _end_cap - _begin);  // deallocate 는 capacity 로
   }
+
+ private:
+  pointer _zeroed_block(typename allocator_type::size_type n, true_type) {
+    return _alloc.allocate_zeroed(n);
+  }
+
+  pointer _zeroed_block(typename allocator_type::size_type n, false_type) {
+    pointer p = _alloc.allocate(n);
+    if (_use_parallel(n * sizeof(T))) {
+      _parallel_memset(p, n, 0);
+    } else {
+      std::memset(static_cast<void*>(p), 0, n * sizeof(T));
+    }
+    return p;
+  }
+
+  typename allocator_type::size_type _usable_size(
+      pointer p, typename allocator_type::size_type n, true_type) const {
+    return p == NULL ? n : _alloc.usable_size(p, n);
+  }
+
+  typename allocator_type::size_type _usable_size(
+      pointer, typename allocator_type::size_type n, false_type) const {
+    return n;
+  }
 };  // !SECTION: vector_base
 
+// SECTION: file descriptor helpers
+// 한 번의 writev 에 넘기는 iovec 의 수. (IOV_MAX 는 POSIX 최소 16, Linux 1024)
+const int _kIovBatch = 64;
+
+/**
+ * @brief element 를 byte 그대로 fd 와 주고받아도 되는 타입에만 정의된다.
+ * false_type 으로 부르면 compile error 가 난다.
+ */
+inline void _require_bitwise_io(true_type) {}
+
+/**
+ * @brief iov[0, count) 를 모두 쓸 때까지 writev 를 반복한다.
+ * 짧게 쓰이면 iov 를 앞으로 당겨서 이어 쓰고 EINTR 은 다시 시도한다.
+ *
+ * @return ssize_t 쓴 byte 수. 실패하면 -1 (errno)
+ */
+inline ssize_t _writev_all(int fd, struct iovec* iov, int count) {
+  ssize_t total = 0;
+  while (count > 0) {
+    ssize_t n = ::writev(fd, iov, count);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    total += n;
+    while (count > 0 && static_cast<size_t>(n) >= iov->iov_len) {
+      n -= iov->iov_len;
+      ++iov;
+      --count;
+    }
+    if (count > 0) {
+      iov->iov_base = static_cast<char*>(iov->iov_base) + n;
+      iov->iov_len -= n;
+    }
+  }
+  return total;
+}
+// !SECTION: file descriptor helpers
+
 // SECTION: vector
-template <typename T, typename Alloc = std::allocator<T> >
+/**
+ * @brief dynamic array
+ *
+ * @tparam T
+ * @tparam Alloc
+ * @tparam GrowthPolicy 재할당 시 새 capacity 를 정하는 정책.
+ * (growth_policy.hpp)
+ */
+template <typename T, typename Alloc = std::allocator<T>,
+          typename GrowthPolicy = growth_double>
 class vector : private vector_base<T, Alloc> {
  public:
   typedef T value_type;
   typedef Alloc allocator_type;
+  typedef GrowthPolicy growth_policy;
   typedef typename allocator_type::reference reference;
   typedef typename allocator_type::const_reference const_reference;
   typedef typename allocator_type::pointer pointer;
@@ -190,11 +311,17 @@ class vector : private vector_base<T, Alloc> {
       : base_(alloc) {}
 
   // fill
+  // 모든 byte 가 0 인 trivial 값은 0 으로 채워진 storage 를 받아 쓰지 않는다.
   explicit vector(size_type n, const value_type& val = value_type(),
                   const allocator_type& alloc = allocator_type())
-      : base_(alloc, n) {
-    std::uninitialized_fill(this->_begin, this->_begin + n, val);
-    this->_end += n;
+      : base_(alloc) {
+    if (_is_zero_fill(val)) {
+      this->_allocate_zeroed(n);
+      this->_end += n;
+    } else {
+      _allocate(n);
+      _construct_at_end(n, val);
+    }
   }
 
   // range
@@ -224,14 +351,25 @@ class vector : private vector_base<T, Alloc> {
                             ForwardIterator>::type last,
          const allocator_type& alloc = allocator_type())
       : base_(alloc, std::distance(first, last)) {
-    this->_end = std::uninitialized_copy(first, last, this->_begin);
+    this->_end = _uninitialized_copy(first, last, this->_begin);
   }
 
   // copy
   vector(const vector& x) : base_(x._alloc, x.size()) {
-    this->_end = std::uninitialized_copy(x._begin, x._end, this->_begin);
+    this->_end = _uninitialized_copy(x._begin, x._end, this->_begin);
   }
 
+#if FT_HAS_MOVE
+  // NOTHROW
+  /**
+   * @brief x 의 storage 를 가져온다. x 는 빈 vector 가 된다.
+   * @complexity O(1)
+   *
+   * @param x
+   */
+  vector(vector&& x) noexcept : base_(std::move(x)) {}
+#endif
+
   // NOTHROW
   /**
    * @brief Destroy the vector object
@@ -259,6 +397,22 @@ class vector : private vector_base<T, Alloc> {
     return *this;
   }
 
+#if FT_HAS_MOVE
+  // NOTHROW
+  /**
+   * @brief x 의 storage 를 가져오고 기존 element 는 해제한다.
+   * @complexity O(size) - 기존 element 의 소멸
+   *
+   * @param x
+   * @return vector&
+   */
+  vector& operator=(vector&& x) noexcept {
+    vector tmp(std::move(x));
+    swap(tmp);
+    return *this;
+  }
+#endif
+
   // SECTION: iterator
   // NOTHROW
   /**
@@ -343,13 +497,19 @@ class vector : private vector_base<T, Alloc> {
    */
   void resize(size_type n, value_type val = value_type()) {
     size_type _size = size();
-    if (n > capacity()) {
+    if (n > capacity() && !_grow_in_place(_get_alloc_size(n))) {
       // STRONG
       // reallocation
       vector tmp;
-      tmp._allocate(_get_alloc_size(n));
-      tmp._end = std::uninitialized_copy(this->_begin, this->_end, tmp._begin);
-      tmp._construct_at_end(n - _size, val);
+      if (_is_zero_fill(val)) {
+        // [size, n) 은 이미 0 이다.
+        tmp._allocate_zeroed(_get_alloc_size(n));
+        _relocate(this->_begin, this->_end, tmp._begin);
+        tmp._end = tmp._begin + n;
+      } else {
+        tmp._allocate(_get_alloc_size(n));
+        _realloc_insert(tmp, this->_end, n - _size, val);
+      }
       swap(tmp);
       return;
     }
@@ -357,10 +517,53 @@ class vector : private vector_base<T, Alloc> {
       _construct_at_end(n - _size, val);
     } else if (n < _size) {
       _destroy_at_end(this->_begin + n);
+      _auto_shrink();
     }
     // else do nothing.
   }
 
+  // STRONG n > size and reallocation required, type of elements is copyable
+  // BASIC otherwise
+  /**
+   * @brief resize 와 같지만 새 element 를 value 로 초기화하지 않고
+   * default initialization 한다. trivial 한 타입 (int, char, POD) 은 값이
+   * 정해지지 않은 채로 남으므로 바로 덮어쓸 buffer 에 사용한다.
+   * @complexity trivial 한 타입은 재할당이 없으면 O(1)
+   *
+   * @param n
+   */
+  void resize_default_init(size_type n) {
+    const size_type _size = size();
+    if (n > _size) {
+      append_uninitialized(n - _size);
+    } else if (n < _size) {
+      _destroy_at_end(this->_begin + n);
+      _auto_shrink();
+    }
+  }
+
+  // STRONG
+  /**
+   * @brief 끝에 n 개의 element 를 default initialization 으로 추가하고 그
+   * 영역의 시작 위치를 리턴한다. read(2), memcpy 처럼 바로 채울 때 사용한다.
+   * 재할당이 일어나면 기존 iterator, pointer 는 무효화된다.
+   *
+   * @param n 추가할 element 의 수
+   * @return pointer 추가된 첫번째 element 의 위치
+   */
+  pointer append_uninitialized(size_type n) {
+    const size_type _size = size();
+    if (_size + n > capacity() && !_grow_in_place(_get_alloc_size(_size + n))) {
+      vector tmp;
+      tmp._allocate(_get_alloc_size(_size + n));
+      _realloc_append_default(tmp, n);
+      swap(tmp);
+    } else {
+      _default_construct_at_end(n);
+    }
+    return this->_begin + _size;
+  }
+
   // NOTHROW
   size_type capacity(void) const { return this->_end_cap - this->_begin; }
 
@@ -379,13 +582,27 @@ class vector : private vector_base<T, Alloc> {
    * @param n 벡터의 최소 capacity
    */
   void reserve(size_type n) {
-    if (n > capacity()) {
+    if (n > capacity() && !_grow_in_place(_get_alloc_size(n))) {
       vector tmp;
       tmp._allocate(_get_alloc_size(n));
-      tmp._end = std::uninitialized_copy(this->_begin, this->_end, tmp._begin);
+      tmp._end = _relocate(this->_begin, this->_end, tmp._begin);
       swap(tmp);
     }
   }
+
+  // STRONG
+  /**
+   * @brief capacity 를 size 로 줄이도록 요청한다.
+   * relocatable 한 타입은 realloc / mremap 으로 복사 없이 줄인다. 그 외
+   * 타입의 mmap 된 storage 는 복사하지 않고 남는 page 만 반납하므로
+   * capacity 가 그대로일 수 있다. 줄어들면 모든 iterator 가 무효화된다.
+   * @complexity 새 storage 로 복사하면 O(N)
+   */
+  void shrink_to_fit(void) {
+    if (capacity() > size()) {
+      _shrink_storage(size(), true);
+    }
+  }
   // !SECTION: capacity
 
   // SECTION: element access
@@ -458,7 +675,16 @@ class vector : private vector_base<T, Alloc> {
               typename enable_if<is_input_iterator<InputIterator>::value &&
                                      !is_forward_iterator<InputIterator>::value,
                                  InputIterator>::type last) {
-    clear();
+    // 이미 생성된 element 는 operator= 로 재사용하고 나머지만 push_back 한다.
+    pointer cur = this->_begin;
+    for (; first != last && cur != this->_end; ++first, ++cur) {
+      *cur = *first;
+    }
+    if (first == last) {
+      _destroy_at_end(cur);
+      _auto_shrink();
+      return;
+    }
     for (; first != last; ++first) {
       push_back(*first);
     }
@@ -486,9 +712,8 @@ class vector : private vector_base<T, Alloc> {
           ++first;
         }
       } else if (cur_size > n) {
-        for (size_type i = n; i < cur_size; ++i) {
-          pop_back();
-        }
+        _destroy_at_end(this->_begin + n);
+        _auto_shrink();
       }
     }
   }
@@ -515,6 +740,7 @@ class vector : private vector_base<T, Alloc> {
         _construct_at_end(n - cur_size, val);
       } else if (cur_size > n) {
         _destroy_at_end(this->_begin + n);
+        _auto_shrink();
       }
     }
   }
@@ -531,13 +757,12 @@ class vector : private vector_base<T, Alloc> {
    * @param val 복사되어 삽입될 element
    */
   void push_back(const value_type& val) {
-    if (this->_end >= this->_end_cap) {  // no more space
+    if (this->_end >= this->_end_cap &&  // no more space
+        (_is_element(val) || !_grow_in_place(_get_alloc_size(size() + 1)))) {
       // reallocation
       vector tmp;
       tmp._allocate(_get_alloc_size(size() + 1));
-      tmp._end = std::uninitialized_copy(this->_begin, this->_end, tmp._begin);
-
-      tmp._construct_at_end(1, val);
+      _realloc_insert(tmp, this->_end, 1, val);
       swap(tmp);
     } else {
       _construct_at_end(1, val);
@@ -552,7 +777,10 @@ class vector : private vector_base<T, Alloc> {
    * @complexity O(1)
    *
    */
-  void pop_back(void) { this->_alloc.destroy(--this->_end); }
+  void pop_back(void) {
+    this->_alloc.destroy(--this->_end);
+    _auto_shrink();
+  }
 
   // STRONG 1. insert single element at the _end, no reallocations happen
   // 2. reallocation happens & elements copyable
@@ -565,27 +793,30 @@ class vector : private vector_base<T, Alloc> {
    * @return iterator 새로 삽입한 elements 의 맨 앞 위치
    */
   iterator insert(iterator position, const value_type& val) {
-    pointer p = this->_begin + (position - begin());
+    const difference_type offset = position - begin();
+    pointer p = this->_begin + offset;
     if (p == this->_end) {
       // STRONG
       push_back(val);
       return this->_end - 1;
     }
-    if (size() + 1 > capacity()) {
+    if (size() + 1 > capacity() &&
+        (_is_element(val) || !_grow_for_insert(size() + 1))) {
       // STRONG
       vector tmp;
       tmp._allocate(_get_alloc_size(size() + 1));
-      tmp._end = std::uninitialized_copy(this->_begin, p, tmp._begin);
-      tmp._construct_at_end(1, val);
-      tmp._end = std::uninitialized_copy(p, this->_end, tmp._end);
+      _realloc_insert(tmp, p, 1, val);
       swap(tmp);
     } else {
       // BASIC
-      _construct_at_end(1, *(this->_end - 1));
-      _copy_elements_backward(p, this->_end - 2, this->_end - 2);
-      *p = val;
+      // val 이 vector 안의 element 일 수 있으므로 shift 전에 복사해둔다.
+      value_type val_copy = val;
+      p = this->_begin + offset;  // storage 가 옮겨졌을 수 있다.
+      this->_end = _relocate(this->_end - 1, this->_end, this->_end);
+      _move_elements_backward(p, this->_end - 2, this->_end - 2);
+      *p = val_copy;
     }
-    return iterator(p);
+    return begin() + offset;
   }
 
   /**
@@ -600,30 +831,41 @@ class vector : private vector_base<T, Alloc> {
     if (n == 0) {
       return;
     }
-    pointer p = this->_begin + (position - begin());
-    if (size() + n > capacity()) {
+    const difference_type offset = position - begin();
+    pointer p = this->_begin + offset;
+    if (size() + n > capacity() &&
+        (_is_element(val) || !_grow_for_insert(size() + n))) {
       // STRONG
       vector tmp;
       tmp._allocate(_get_alloc_size(size() + n));
-      tmp._end = std::uninitialized_copy(this->_begin, p, tmp._begin);
-      std::uninitialized_fill_n(tmp._end, n, val);
-      tmp._end = std::uninitialized_copy(p, this->_end, tmp._end + n);
+      _realloc_insert(tmp, p, n, val);
       swap(tmp);
     } else {
       // BASIC
-      if (p != this->_end) {
-        pointer old_end = this->_end;
-        this->_end = std::uninitialized_copy(old_end - n, old_end, old_end);
-        _copy_elements_backward(p, old_end - n, old_end - 1);
-        _fill_n_elements(p, n, val);
+      value_type val_copy = val;
+      p = this->_begin + offset;
+      pointer old_end = this->_end;
+      size_type elems_after = old_end - p;
+      if (elems_after > n) {
+        // [end - n, end) 를 end 에 construct 하고 나머지는 뒤로 민다.
+        this->_end = _relocate(old_end - n, old_end, old_end);
+        _move_elements_backward(p, old_end - n, old_end - 1);
+        _fill_n_elements(p, n, val_copy);
       } else {
-        _construct_at_end(n, val);
+        // end 를 넘어가는 val 은 construct, [p, end) 는 그 뒤로 construct
+        _construct_at_end(n - elems_after, val_copy);
+        this->_end = _relocate(p, old_end, this->_end);
+        _fill_n_elements(p, elems_after, val_copy);
       }
     }
   }
 
+  // BASIC
   /**
    * @brief position 앞 위치에 [first, last) 의 element 를 삽입한다.
+   * 길이를 미리 알 수 없으므로 end 에 push_back 한 뒤 position 으로 rotate
+   * 한다. element 마다 뒤를 미는 것보다 빠르다.
+   * @complexity O(N + M) N 은 position 뒤의 element 수, M 은 range 의 길이
    *
    * @tparam InputIterator
    * @param position
@@ -638,13 +880,19 @@ class vector : private vector_base<T, Alloc> {
     if (first == last) {
       return;
     }
-    difference_type offset = position - begin();
-    difference_type n = offset;
-    for (; first != last; ++first) {
-      // 재할당이 일어날 수도 있다. 일어난다면 position 무효화됨.
-      insert(this->_begin + n, *first);
-      ++n;
+    const difference_type offset = position - begin();
+    const size_type old_size = size();
+    try {
+      for (; first != last; ++first) {
+        push_back(*first);
+      }
+    } catch (...) {
+      _destroy_at_end(this->_begin + old_size);  // rollback
+      throw;
     }
+    // 재할당이 일어났을 수 있으므로 offset 으로 다시 계산한다.
+    _rotate_elements(this->_begin + offset, this->_begin + old_size,
+                     this->_end);
   }
 
   /**
@@ -661,32 +909,35 @@ class vector : private vector_base<T, Alloc> {
               typename enable_if<is_forward_iterator<ForwardIterator>::value,
                                  ForwardIterator>::type last) {
     difference_type n = std::distance(first, last);
-    pointer p = this->_begin + (position - begin());
+    const difference_type offset = position - begin();
+    pointer p = this->_begin + offset;
     if (n == 0) {
       return;
     }
-    if (size() + n > capacity()) {
+    if (size() + n > capacity() && !_grow_for_insert(size() + n)) {
       // STRONG
       vector tmp;
       tmp._allocate(_get_alloc_size(size() + n));
-      tmp._end = std::uninitialized_copy(this->_begin, p, tmp._begin);
-      tmp._end = std::uninitialized_copy(first, last, tmp._end);
-      tmp._end = std::uninitialized_copy(p, this->_end, tmp._end);
+      _realloc_insert_range(tmp, p, first, last);
       swap(tmp);
     } else {
       // BASIC
-      if (p != this->_end) {
+      p = this->_begin + offset;
+      pointer old_end = this->_end;
+      difference_type elems_after = old_end - p;
+      if (elems_after > n) {
         // [end - n, end) 까지를 end 에 construct (n개)
-        pointer old_end = this->_end;
-        this->_end = std::uninitialized_copy(old_end - n, old_end, old_end);
-        // [position, end - n) 까지를 [end - n,  end) 까지로 copy (aps - n개)
-        _copy_elements_backward(p, old_end - n, old_end);
+        this->_end = _relocate(old_end - n, old_end, old_end);
+        // [position, end - n) 까지를 [position + n, end) 까지로 copy
+        _move_elements_backward(p, old_end - n, old_end - 1);
         _copy_elements(first, last, p);
       } else {
-        // position == end
-        for (; first != last; ++first) {
-          push_back(*first);
-        }
+        // range 중 end 를 넘어가는 부분 [mid, last) 와 [p, end) 를 construct
+        ForwardIterator mid = first;
+        std::advance(mid, elems_after);
+        this->_end = _uninitialized_copy(mid, last, old_end);
+        this->_end = _relocate(p, old_end, this->_end);
+        _copy_elements(first, mid, p);
       }
     }
   }
@@ -703,12 +954,14 @@ class vector : private vector_base<T, Alloc> {
    * @return iterator 함수 호출로 지워진 마지막 element 의 다음 위치
    */
   iterator erase(iterator position) {
-    pointer p = this->_begin + (position - begin());
+    const difference_type offset = position - begin();
+    pointer p = this->_begin + offset;
     if (p != this->_end - 1) {
-      _copy_elements(p + 1, this->_end, p);
+      _move_elements(p + 1, this->_end, p);
     }
     _destroy_at_end(this->_end - 1);
-    return iterator(p);
+    _auto_shrink();
+    return begin() + offset;
   }
 
   /**
@@ -720,13 +973,87 @@ class vector : private vector_base<T, Alloc> {
    * @return iterator following last removed element
    */
   iterator erase(iterator first, iterator last) {
-    pointer first_p = this->_begin + (first - begin());
+    const difference_type offset = first - begin();
+    pointer first_p = this->_begin + offset;
     pointer last_p = this->_begin + (last - begin());
     if (first_p != last_p) {
-      _copy_elements(last_p, this->_end, first_p);
+      _move_elements(last_p, this->_end, first_p);
       _destroy_at_end(this->_end - (last_p - first_p));
+      _auto_shrink();
+    }
+    return begin() + offset;
+  }
+
+  // BASIC
+  /**
+   * @brief pred 가 true 인 element 를 모두 지운다. 남는 element 들은 순서를
+   * 유지한 채 한 번에 앞으로 모이고, 끝은 한 번만 destroy 한다.
+   * erase(iterator) 를 반복하면 지울 때마다 뒤를 전부 옮기므로 O(N^2) 이다.
+   * @complexity O(N) pred 는 N 번, 남은 element 의 이동은 연속된 구간 단위
+   *
+   * @param pred value_type 을 받아 bool 을 리턴하는 predicate
+   * @return size_type 지운 element 의 수
+   */
+  template <typename Predicate>
+  size_type erase_if(Predicate pred) {
+    pointer dest = this->_begin;
+    while (dest != this->_end && !pred(*dest)) {
+      ++dest;
     }
-    return iterator(first_p);
+    if (dest == this->_end) {
+      return 0;
+    }
+    pointer src = dest + 1;
+    while (src != this->_end) {
+      if (pred(*src)) {
+        ++src;
+        continue;
+      }
+      pointer run_end = src + 1;
+      while (run_end != this->_end && !pred(*run_end)) {
+        ++run_end;
+      }
+      dest = _move_elements(src, run_end, dest);
+      // run_end 는 이미 pred 가 true 인 element 이므로 다시 묻지 않는다.
+      src = run_end;
+      if (src != this->_end) {
+        ++src;
+      }
+    }
+    return _erase_tail(dest);
+  }
+
+  // BASIC
+  /**
+   * @brief 오름차순으로 정렬된 index 들의 element 를 지운다. 같은 index 가
+   * 여러 번 있어도 된다. 사이에 남는 구간들을 한 번씩만 옮긴다.
+   * 범위를 벗어나거나 정렬되지 않은 index 는 UB.
+   * @complexity O(N) 첫 index 뒤의 element 수 + index 의 수
+   *
+   * @param first 지울 index 의 범위
+   * @param last
+   * @return size_type 지운 element 의 수
+   */
+  template <typename InputIterator>
+  size_type erase_indices(
+      InputIterator first,
+      typename enable_if<is_input_iterator<InputIterator>::value,
+                         InputIterator>::type last) {
+    if (first == last) {
+      return 0;
+    }
+    pointer dest = this->_begin + *first;
+    pointer src = dest;  // [src, 다음 index) 는 남는 구간
+    for (; first != last; ++first) {
+      pointer victim = this->_begin + *first;
+      if (victim < src) {
+        continue;  // 중복된 index
+      }
+      dest = _move_elements(src, victim, dest);
+      src = victim + 1;
+    }
+    dest = _move_elements(src, this->_end, dest);
+    return _erase_tail(dest);
   }
 
   // NOTHROW allocator in both vectors compare equal
@@ -743,14 +1070,111 @@ class vector : private vector_base<T, Alloc> {
     ft::swap(this->_end_cap, x._end_cap);
   }
 
+  // STRONG
+  /**
+   * @brief 다른 layer 가 할당하고 채운 block 의 소유권을 복사 없이 가져온다.
+   * 기존 element 는 destroy 하고 storage 는 해제한다.
+   * p 는 alloc.allocate(cap) 으로 할당한 block 이고 [p, p + n) 은 생성된
+   * element 여야 한다. 이후 get_allocator() 로 해제하므로 alloc 이
+   * get_allocator() 와 같지 않으면 invalid_argument 를 던지고 아무것도 바꾸지
+   * 않는다.
+   * @complexity O(size) (기존 element 의 destroy)
+   *
+   * @param p block 의 시작. cap 이 0 이면 NULL 일 수 있다.
+   * @param n 생성된 element 의 개수
+   * @param cap 할당한 element 의 개수
+   * @param alloc p 를 할당한 allocator
+   */
+  void adopt(pointer p, size_type n, size_type cap,
+             const allocator_type& alloc = allocator_type()) {
+    if (!(alloc == this->_alloc)) {
+      throw std::invalid_argument("ft::vector::adopt : allocator mismatch");
+    }
+    if (n > cap || cap > max_size() || (p == NULL && cap != 0)) {
+      throw std::invalid_argument("ft::vector::adopt : invalid block");
+    }
+    vector old;
+    swap(old);  // 기존 storage 는 old 와 함께 해제된다.
+    this->_begin = p;
+    this->_end = p + n;
+    this->_end_cap = p + this->_usable_size(p, cap);
+  }
+
+  // NOTHROW
+  /**
+   * @brief storage 의 소유권을 복사 없이 넘기고 빈 vector (capacity 0) 가
+   * 된다. size() 와 capacity() 는 호출 전에 읽어야 한다.
+   * 받은 쪽은 element 를 destroy 한 뒤 get_allocator().deallocate(p,
+   * capacity) 로 해제하거나 같은 allocator 의 vector 에 adopt 한다.
+   * @complexity O(1)
+   *
+   * @return pointer 비어있던 vector 면 NULL
+   */
+  pointer release(void) {
+    pointer p = this->_begin;
+    this->_begin = this->_end = this->_end_cap = NULL;
+    return p;
+  }
+
   // NOTHROW
   /**
    * @brief 모든 elements 를 삭제한다. size 를 0으로 설정한다.
    * @complexity O(N)
    */
-  void clear(void) { _destroy_at_end(this->_begin); }
+  void clear(void) {
+    _destroy_at_end(this->_begin);
+    _auto_shrink();
+  }
   // !SECTION: modifiers
 
+  // SECTION: file descriptor I/O
+  // STRONG
+  /**
+   * @brief fd 에서 최대 max_bytes 를 spare capacity [end, end_cap) 로 바로
+   * read(2) 해서 끝에 붙인다. stack buffer 를 거쳐 복사하지 않는다.
+   * spare capacity 가 모자라면 먼저 growth policy 대로 늘린다.
+   * byte 크기의 trivially copyable 타입 (char, unsigned char) 에만 쓸 수 있다.
+   * @complexity 재할당이 없으면 읽은 byte 수에 비례
+   *
+   * @return ssize_t 읽은 byte 수. 0 이면 EOF, -1 이면 실패 (errno) 이고 size
+   * 는 그대로다. (늘어난 capacity 는 남는다.)
+   */
+  ssize_t append_from_fd(int fd, size_type max_bytes) {
+    typedef integral_constant<
+        bool, sizeof(value_type) == 1 &&
+                  is_trivially_copyable<value_type>::value>
+        is_byte;
+    _require_bitwise_io(is_byte());
+    max_bytes = min(max_bytes, static_cast<size_type>(
+                                   std::numeric_limits<ssize_t>::max()));
+    if (static_cast<size_type>(this->_end_cap - this->_end) < max_bytes) {
+      reserve(size() + max_bytes);
+    }
+    ssize_t n;
+    do {
+      n = ::read(fd, static_cast<void*>(this->_end), max_bytes);
+    } while (n < 0 && errno == EINTR);
+    if (n > 0) {
+      this->_end += n;
+    }
+    return n;
+  }
+
+  /**
+   * @brief 모든 element 를 byte 그대로 fd 에 쓴다. 짧게 쓰이면 이어서 쓴다.
+   * 여러 vector 를 한 번에 쓰려면 non-member write_to_fd 를 사용한다.
+   *
+   * @return ssize_t 쓴 byte 수. 실패하면 -1 (errno)
+   */
+  ssize_t write_to_fd(int fd) const {
+    _require_bitwise_io(is_trivially_copyable<value_type>());
+    struct iovec iov;
+    iov.iov_base = const_cast<void*>(static_cast<const void*>(this->_begin));
+    iov.iov_len = size() * sizeof(value_type);
+    return _writev_all(fd, &iov, iov.iov_len == 0 ? 0 : 1);
+  }
+  // !SECTION: file descriptor I/O
+
   // NOTHROW
   /**
    * @brief Get the allocator object
@@ -765,6 +1189,43 @@ class vector : private vector_base<T, Alloc> {
  private:
   typedef vector_base<T, Alloc> base_;
 
+  // element 를 bitwise 로 옮겨도 되고 allocator 가 reallocate 를 제공하는지
+  typedef integral_constant<bool,
+                            _has_reallocate<allocator_type>::value &&
+                                is_trivially_relocatable<value_type>::value>
+      _can_reallocate;
+
+  // C++11 에서 element 를 복사하지 않고 move 해도 되는지.
+  // move 생성자가 noexcept 가 아니면 재할당 중 예외가 났을 때 원본을 되돌릴
+  // 수 없으므로 복사한다. bitwise 로 옮길 수 있는 타입은 memmove 를 쓴다.
+#if FT_HAS_MOVE
+  typedef integral_constant<
+      bool, !is_trivially_copyable<value_type>::value &&
+                std::is_nothrow_move_constructible<value_type>::value>
+      _use_move;
+#else
+  typedef false_type _use_move;
+#endif
+
+  // move 할 수 없어도 (C++98) is_swap_relocatable 한 타입은 default 생성 후
+  // swap 으로 옮긴다. (vector<vector<T> > 의 안쪽 vector 를 복사하지 않는다.)
+  typedef integral_constant<
+      bool, !is_trivially_copyable<value_type>::value && !_use_move::value &&
+                is_swap_relocatable<value_type>::value>
+      _use_swap;
+
+  /**
+   * @brief U* 범위가 value_type 의 연속된 메모리이고 memmove 로 복사해도 되는지
+   * 판별한다. 아니면 element 단위로 copy / construct 한다.
+   *
+   * @tparam U const 가 붙을 수 있는 value_type
+   */
+  template <typename U>
+  struct _is_bitwise_range
+      : public integral_constant<
+            bool, is_same<typename remove_cv<U>::type, value_type>::value &&
+                      is_trivially_copyable<value_type>::value> {};
+
   /**
    * @brief 적절히 resize 할 크기를 리턴한다.
    * push_back(), resize(), assign() 등에서 사용
@@ -777,11 +1238,129 @@ class vector : private vector_base<T, Alloc> {
     if (new_size > _max_size) {
       throw std::logic_error("ft::vector : reallocation size is too big");
     }
-    const size_type cap = capacity();
-    if (cap >= _max_size / 2) {
-      return _max_size;
+    const size_type next = GrowthPolicy::next_capacity(
+        capacity(), new_size, _max_size, sizeof(value_type));
+    return max(min(next, _max_size), new_size);
+  }
+
+  /**
+   * @brief 새 block 에 element 를 복사하지 않고 capacity 를 n 으로 늘려본다.
+   * 1. allocator 가 try_expand 를 제공하면 block 을 제자리에서 늘린다.
+   * 2. element 가 bitwise relocatable 하고 allocator 가 reallocate 를
+   * 제공하면 realloc / mremap 으로 block 째 옮긴다.
+   * 실패하면 storage 는 그대로이고 false 를 리턴한다.
+   * 2번은 storage 를 옮기므로 호출 전에 얻은 pointer 는 무효화된다.
+   *
+   * @param n 새 capacity
+   * @return true capacity() >= n
+   */
+  bool _grow_in_place(size_type n) {
+    if (this->_begin == NULL) {
+      return false;
+    }
+    if (_try_expand(n, _has_try_expand<allocator_type>())) {
+      return true;
+    }
+    return _try_reallocate(n, _can_reallocate());
+  }
+
+  bool _try_expand(size_type n, true_type) {
+    if (!this->_alloc.try_expand(this->_begin, capacity(), n)) {
+      return false;
+    }
+    this->_end_cap = this->_begin + this->_usable_size(this->_begin, n);
+    return true;
+  }
+
+  bool _try_expand(size_type, false_type) { return false; }
+
+  bool _try_reallocate(size_type n, true_type) {
+    const size_type _size = size();
+    this->_begin = this->_alloc.reallocate(this->_begin, capacity(), n);
+    this->_end = this->_begin + _size;
+    this->_end_cap = this->_begin + this->_usable_size(this->_begin, n);
+    return true;
+  }
+
+  bool _try_reallocate(size_type, false_type) { return false; }
+
+  /**
+   * @brief capacity 를 n (size <= n < capacity) 으로 줄인다.
+   * 1. n 이 0 이면 storage 를 해제한다.
+   * 2. relocatable 한 타입이고 allocator 가 reallocate 를 제공하면 realloc /
+   * mremap 으로 줄인다. (복사 없음)
+   * 3. allow_discard 이고 allocator 가 discard 를 제공하면 남는 page 만
+   * 반납한다. capacity 는 그대로다.
+   * 4. 아니면 n 크기의 새 storage 로 복사한다.
+   *
+   * @param n 새 capacity
+   * @param allow_discard capacity 를 줄이지 않고 page 만 반납해도 되는지
+   */
+  void _shrink_storage(size_type n, bool allow_discard) {
+    if (n == 0) {
+      vector().swap(*this);
+      return;
+    }
+    if (_try_reallocate(n, _can_reallocate())) {
+      return;
+    }
+    if (allow_discard && _try_discard(_has_discard<allocator_type>())) {
+      return;
     }
-    return max(2 * cap, new_size);
+    vector tmp;
+    tmp._allocate(n);
+    tmp._end = _relocate(this->_begin, this->_end, tmp._begin);
+    swap(tmp);
+  }
+
+  bool _try_discard(true_type) {
+    return this->_alloc.discard(this->_begin, size(), capacity());
+  }
+
+  bool _try_discard(false_type) { return false; }
+
+  /**
+   * @brief GrowthPolicy 가 shrink_capacity 를 제공하면 size 가 줄어든 뒤
+   * capacity 를 줄인다. 줄이지 못해도 (bad_alloc, 복사 중 예외) 원래
+   * storage 가 그대로 남으므로 예외는 무시한다.
+   * 자주 불리므로 page 반납 (discard) 은 하지 않는다.
+   */
+  void _auto_shrink(void) {
+    _auto_shrink(_has_shrink_capacity<growth_policy>());
+  }
+
+  void _auto_shrink(true_type) {
+    const size_type n = growth_policy::shrink_capacity(size(), capacity());
+    if (n >= capacity()) {
+      return;
+    }
+    try {
+      _shrink_storage(max(n, size()), false);
+    } catch (...) {
+      // best effort
+    }
+  }
+
+  void _auto_shrink(false_type) {}
+
+  /**
+   * @brief 중간 insert 를 위해 storage 를 늘린다. 늘린 뒤에는 element 를
+   * 제자리에서 shift 하므로 (BASIC) bitwise relocatable 한 타입에만 허용하고,
+   * 나머지 타입은 재할당 경로의 STRONG guarantee 를 유지한다.
+   *
+   * @param new_size insert 후의 size
+   */
+  bool _grow_for_insert(size_type new_size) {
+    return is_trivially_relocatable<value_type>::value &&
+           _grow_in_place(_get_alloc_size(new_size));
+  }
+
+  /**
+   * @brief val 이 이 vector 의 element 인지 확인한다.
+   * storage 를 옮기는 경로에서 val 이 무효화되지 않도록 할 때 사용한다.
+   */
+  bool _is_element(const value_type& val) const {
+    return &val >= this->_begin && &val < this->_end;
   }
 
   /**
@@ -791,7 +1370,7 @@ class vector : private vector_base<T, Alloc> {
    */
   void _allocate(size_type n) {
     this->_end = this->_begin = this->_alloc.allocate(n);
-    this->_end_cap = this->_begin + n;
+    this->_end_cap = this->_begin + this->_usable_size(this->_begin, n);
   }
 
   /**
@@ -815,9 +1394,44 @@ class vector : private vector_base<T, Alloc> {
    * @param val 생성할 element 의 값
    */
   void _construct_at_end(size_type n, const value_type& val) {
-    for (size_type idx = 0; idx < n; ++idx) {
-      _construct_element(this->_end, val);
-      ++this->_end;
+    if (is_trivially_copyable<value_type>::value) {
+      // bitwise 로 채우므로 (memset, parallel) 예외가 없고 rollback 도 필요
+      // 없다.
+      this->_end = _fill_n_elements(this->_end, n, val);
+      return;
+    }
+    pointer old_end = this->_end;
+    try {
+      for (size_type idx = 0; idx < n; ++idx) {
+        _construct_element(this->_end, val);
+        ++this->_end;
+      }
+    } catch (...) {
+      _destroy_at_end(old_end);  // rollback
+      throw;
+    }
+  }
+
+  /**
+   * @brief end() 위치에 n개의 element를 default initialization 으로 생성한다.
+   * trivial 한 타입은 생성자가 없으므로 end 만 옮긴다.
+   *
+   * @param n 생성할 element 의 개수
+   */
+  void _default_construct_at_end(size_type n) {
+    if (is_trivially_default_constructible<value_type>::value) {
+      this->_end += n;
+      return;
+    }
+    pointer old_end = this->_end;
+    try {
+      for (size_type idx = 0; idx < n; ++idx) {
+        ::new (static_cast<void*>(this->_end)) value_type;
+        ++this->_end;
+      }
+    } catch (...) {
+      _destroy_at_end(old_end);  // rollback
+      throw;
     }
   }
 
@@ -828,12 +1442,25 @@ class vector : private vector_base<T, Alloc> {
    * @param pos
    */
   void _destroy_at_end(pointer pos) {
-    for (pointer tmp = pos; tmp < this->_end; ++tmp) {
-      _destroy_element(tmp);
+    if (!is_trivially_destructible<value_type>::value) {
+      for (pointer tmp = pos; tmp < this->_end; ++tmp) {
+        _destroy_element(tmp);
+      }
     }
     this->_end = pos;
   }
 
+  /**
+   * @brief [pos, end) 를 destroy 하고 지운 element 의 수를 리턴한다.
+   * (erase_if, erase_indices)
+   */
+  size_type _erase_tail(pointer pos) {
+    const size_type n = this->_end - pos;
+    _destroy_at_end(pos);
+    _auto_shrink();
+    return n;
+  }
+
   /**
    * @brief allocator 캡슐화하는 construct 함수
    *
@@ -869,6 +1496,23 @@ class vector : private vector_base<T, Alloc> {
     return dest;
   }
 
+  /**
+   * @brief trivially copyable 한 value_type 의 연속된 범위는 memmove 로
+   * 복사한다. 범위가 겹쳐도 된다. (erase)
+   */
+  template <typename U>
+  typename enable_if<_is_bitwise_range<U>::value, pointer>::type
+  _copy_elements(U* begin, U* end, pointer dest) {
+    return _bitwise_copy(begin, end, dest);
+  }
+
+  template <typename U>
+  typename enable_if<_is_bitwise_range<U>::value, pointer>::type
+  _copy_elements(vector_iterator<U*> begin, vector_iterator<U*> end,
+                 pointer dest) {
+    return _bitwise_copy(begin.base(), end.base(), dest);
+  }
+
   /**
    * @brief copy of std::copy_backward
    * [begin, end)
@@ -888,6 +1532,263 @@ class vector : private vector_base<T, Alloc> {
     return dest;
   }
 
+  template <typename U>
+  typename enable_if<_is_bitwise_range<U>::value, pointer>::type
+  _copy_elements_backward(U* begin, U* end, pointer dest) {
+    if (end <= begin) {
+      return dest;
+    }
+    _bitwise_copy(begin, end, dest - (end - begin - 1));
+    return dest - (end - begin);
+  }
+
+  /**
+   * @brief uninitialized 영역 dest 에 [first, last) 를 construct 한다.
+   * bitwise 복사가 가능한 범위는 memmove, 아니면 std::uninitialized_copy.
+   *
+   * @return pointer construct 한 마지막 위치의 다음 위치
+   */
+  template <typename InputIterator>
+  pointer _uninitialized_copy(InputIterator first, InputIterator last,
+                              pointer dest) {
+    return std::uninitialized_copy(first, last, dest);
+  }
+
+  template <typename U>
+  typename enable_if<_is_bitwise_range<U>::value, pointer>::type
+  _uninitialized_copy(U* first, U* last, pointer dest) {
+    return _bitwise_copy(first, last, dest);
+  }
+
+  template <typename U>
+  typename enable_if<_is_bitwise_range<U>::value, pointer>::type
+  _uninitialized_copy(vector_iterator<U*> first, vector_iterator<U*> last,
+                      pointer dest) {
+    return _bitwise_copy(first.base(), last.base(), dest);
+  }
+
+  /**
+   * @brief uninitialized 영역 dest 로 [first, last) 의 element 를 옮긴다.
+   * _use_move 이면 move 생성, _use_swap 이면 default 생성 후 swap 하고
+   * 아니면 _uninitialized_copy 로 복사한다.
+   * 원본 element 는 호출한 쪽에서 소멸시킨다.
+   *
+   * @return pointer 옮긴 마지막 위치의 다음 위치
+   */
+  pointer _relocate(pointer first, pointer last, pointer dest) {
+    return _relocate(first, last, dest, _use_move(), _use_swap());
+  }
+
+  pointer _relocate(pointer first, pointer last, pointer dest, false_type,
+                    false_type) {
+    return _uninitialized_copy(first, last, dest);
+  }
+
+  pointer _relocate(pointer first, pointer last, pointer dest, false_type,
+                    true_type) {
+    for (; first != last; ++first, ++dest) {
+      ::new (static_cast<void*>(dest)) value_type();
+      dest->swap(*first);
+    }
+    return dest;
+  }
+
+#if FT_HAS_MOVE
+  pointer _relocate(pointer first, pointer last, pointer dest, true_type,
+                    false_type) {
+    for (; first != last; ++first, ++dest) {
+      ::new (static_cast<void*>(dest)) value_type(std::move(*first));
+    }
+    return dest;
+  }
+#endif
+
+  /**
+   * @brief 생성된 element 들 사이에서 [begin, end) 를 dest 로 옮긴다. (erase)
+   * _relocate 와 같은 기준으로 move 대입, swap, _copy_elements 중 하나.
+   */
+  pointer _move_elements(pointer begin, pointer end, pointer dest) {
+    return _move_elements(begin, end, dest, _use_move(), _use_swap());
+  }
+
+  pointer _move_elements(pointer begin, pointer end, pointer dest,
+                         false_type, false_type) {
+    return _copy_elements(begin, end, dest);
+  }
+
+  pointer _move_elements(pointer begin, pointer end, pointer dest,
+                         false_type, true_type) {
+    for (; begin != end; ++begin, ++dest) {
+      dest->swap(*begin);
+    }
+    return dest;
+  }
+
+  /**
+   * @brief _copy_elements_backward 의 move 버전. (insert 의 shift)
+   */
+  pointer _move_elements_backward(pointer begin, pointer end, pointer dest) {
+    return _move_elements_backward(begin, end, dest, _use_move(),
+                                   _use_swap());
+  }
+
+  pointer _move_elements_backward(pointer begin, pointer end, pointer dest,
+                                  false_type, false_type) {
+    return _copy_elements_backward(begin, end, dest);
+  }
+
+  pointer _move_elements_backward(pointer begin, pointer end, pointer dest,
+                                  false_type, true_type) {
+    while (end != begin) {
+      dest->swap(*--end);
+      --dest;
+    }
+    return dest;
+  }
+
+#if FT_HAS_MOVE
+  pointer _move_elements(pointer begin, pointer end, pointer dest,
+                         true_type, false_type) {
+    for (; begin != end; ++begin, ++dest) {
+      *dest = std::move(*begin);
+    }
+    return dest;
+  }
+
+  pointer _move_elements_backward(pointer begin, pointer end, pointer dest,
+                                  true_type, false_type) {
+    while (end != begin) {
+      *dest = std::move(*--end);
+      --dest;
+    }
+    return dest;
+  }
+#endif
+
+  // SECTION: reallocation
+  // 재할당할 때는 새 element 를 새 storage 에 먼저 생성하고 기존 element 를
+  // 그 앞뒤로 옮긴다. 새 element 가 이 vector 의 element 를 참조하고 있거나
+  // 생성 중 예외가 나도 원본은 아직 옮겨지지 않았으므로 그대로 남는다.
+
+  /**
+   * @brief 새 storage tmp 의 pos 자리에 val 을 n 개 생성하고 기존 element 를
+   * 옮긴다.
+   *
+   * @param tmp capacity 가 size() + n 이상인 빈 vector
+   * @param pos 새 element 가 들어갈 위치 (이 vector 의 pointer)
+   */
+  void _realloc_insert(vector& tmp, pointer pos, size_type n,
+                       const value_type& val) {
+    tmp._end = tmp._begin + (pos - this->_begin);
+    try {
+      tmp._construct_at_end(n, val);
+    } catch (...) {
+      tmp._end = tmp._begin;  // 앞부분은 아직 비어있다.
+      throw;
+    }
+    _relocate_around(tmp, pos);
+  }
+
+  template <typename ForwardIterator>
+  void _realloc_insert_range(vector& tmp, pointer pos, ForwardIterator first,
+                             ForwardIterator last) {
+    pointer gap = tmp._begin + (pos - this->_begin);
+    tmp._end = _uninitialized_copy(first, last, gap);
+    _relocate_around(tmp, pos);
+  }
+
+  void _realloc_append_default(vector& tmp, size_type n) {
+    tmp._end = tmp._begin + size();
+    try {
+      tmp._default_construct_at_end(n);
+    } catch (...) {
+      tmp._end = tmp._begin;
+      throw;
+    }
+    _relocate_around(tmp, this->_end);
+  }
+
+  /**
+   * @brief tmp 의 [pos 자리, tmp.end) 에 새 element 가 생성된 상태에서 기존
+   * element 를 그 앞뒤로 옮긴다. 복사 중 예외가 나면 tmp 에 생성한 element
+   * 는 모두 소멸된다.
+   */
+  void _relocate_around(vector& tmp, pointer pos) {
+    pointer gap = tmp._begin + (pos - this->_begin);
+    pointer gap_end = tmp._end;
+    tmp._end = tmp._begin;
+    try {
+      _relocate(this->_begin, pos, tmp._begin);
+    } catch (...) {
+      tmp._end = gap_end;
+      tmp._destroy_at_end(gap);
+      tmp._end = tmp._begin;
+      throw;
+    }
+    tmp._end = gap_end;
+    tmp._end = _relocate(pos, this->_end, gap_end);
+  }
+  // !SECTION: reallocation
+
+  /**
+   * @brief [middle, last) 가 first 위치로 오도록 range 를 회전한다.
+   * (std::rotate)
+   * @complexity O(N) last - first
+   */
+  void _rotate_elements(pointer first, pointer middle, pointer last) {
+    if (first == middle || middle == last) {
+      return;
+    }
+    _rotate_elements(first, middle, last,
+                     typename _is_bitwise_range<value_type>::type());
+  }
+
+  /**
+   * @brief 짧은 쪽을 side buffer 로 옮겨두고 긴 쪽을 memmove 한다.
+   */
+  void _rotate_elements(pointer first, pointer middle, pointer last,
+                        true_type) {
+    const size_type front = middle - first;
+    const size_type back = last - middle;
+    if (back <= front) {
+      pointer buf = this->_alloc.allocate(back);
+      _bitwise_copy(middle, last, buf);
+      _bitwise_copy(first, middle, first + back);
+      _bitwise_copy(buf, buf + back, first);
+      this->_alloc.deallocate(buf, back);
+    } else {
+      pointer buf = this->_alloc.allocate(front);
+      _bitwise_copy(first, middle, buf);
+      _bitwise_copy(middle, last, first);
+      _bitwise_copy(buf, buf + front, first + back);
+      this->_alloc.deallocate(buf, front);
+    }
+  }
+
+  void _rotate_elements(pointer first, pointer middle, pointer last,
+                        false_type) {
+    std::rotate(first, middle, last);
+  }
+
+  /**
+   * @brief [first, last) 를 dest 에 memmove 한다.
+   * _is_bitwise_range 인 경우에만 호출해야 한다.
+   *
+   * @return pointer 복사한 마지막 위치의 다음 위치
+   */
+  static pointer _bitwise_copy(const_pointer first, const_pointer last,
+                               pointer dest) {
+    const size_type n = last - first;
+    if (_use_parallel(n * sizeof(value_type)) &&
+        (dest + n <= first || last <= dest)) {
+      _parallel_copy(dest, first, n);
+    } else if (n != 0) {
+      std::memmove(static_cast<void*>(dest), static_cast<const void*>(first),
+                   n * sizeof(value_type));
+    }
+    return dest + n;
+  }
+
   /**
    * @brief copy of std::fill_n specialization for T
    *
@@ -897,47 +1798,91 @@ class vector : private vector_base<T, Alloc> {
    * @return pointer 채운 마지막 위치의 다음 위치
    */
   pointer _fill_n_elements(pointer dest, size_type n, const value_type& val) {
+    if (is_trivially_copyable<value_type>::value && n != 0 &&
+        (sizeof(value_type) == 1 || _is_zero_bits(val))) {
+      const unsigned char byte = *reinterpret_cast<const unsigned char*>(&val);
+      if (_use_parallel(n * sizeof(value_type))) {
+        _parallel_memset(dest, n, byte);
+      } else {
+        std::memset(static_cast<void*>(dest), byte, n * sizeof(value_type));
+      }
+      return dest + n;
+    }
+    if (is_trivially_copyable<value_type>::value &&
+        _use_parallel(n * sizeof(value_type))) {
+      _parallel_fill(dest, n, val);
+      return dest + n;
+    }
     for (size_type idx = 0; idx < n; ++idx) {
       *dest = val;
       ++dest;
     }
     return dest;
   }
+
+  /**
+   * @brief val 로 채우는 대신 0 으로 채워진 storage 를 받아 써도 되는지
+   * 확인한다. (trivial 하고 모든 byte 가 0)
+   */
+  static bool _is_zero_fill(const value_type& val) {
+    return is_trivially_copyable<value_type>::value && _is_zero_bits(val);
+  }
+
+  /**
+   * @brief val 의 object representation 이 모두 0 인지 확인한다.
+   * 0 이면 memset 으로 채울 수 있다.
+   *
+   * @param val
+   * @return true 모든 byte 가 0
+   */
+  static bool _is_zero_bits(const value_type& val) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&val);
+    for (size_type idx = 0; idx < sizeof(value_type); ++idx) {
+      if (bytes[idx] != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
   // !SECTION: private member function
 };
 
 // SECTION: non-member function of vector operator
 // SECTION: relational operators
 // NOTHROW if the type of elements supports operations
-template <typename T, typename Alloc>
-bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename G>
+bool operator==(const vector<T, Alloc, G>& lhs,
+                const vector<T, Alloc, G>& rhs) {
   return (lhs.size() == rhs.size()) &&
          equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename T, typename Alloc>
-bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename G>
+bool operator!=(const vector<T, Alloc, G>& lhs,
+                const vector<T, Alloc, G>& rhs) {
   return !(lhs == rhs);
 }
 
-template <typename T, typename Alloc>
-bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename G>
+bool operator<(const vector<T, Alloc, G>& lhs, const vector<T, Alloc, G>& rhs) {
   return lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
                                  rhs.end());
 }
 
-template <typename T, typename Alloc>
-bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename G>
+bool operator>(const vector<T, Alloc, G>& lhs, const vector<T, Alloc, G>& rhs) {
   return rhs < lhs;
 }
 
-template <typename T, typename Alloc>
-bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename G>
+bool operator<=(const vector<T, Alloc, G>& lhs,
+                const vector<T, Alloc, G>& rhs) {
   return !(rhs < lhs);
 }
 
-template <typename T, typename Alloc>
-bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <typename T, typename Alloc, typename G>
+bool operator>=(const vector<T, Alloc, G>& lhs,
+                const vector<T, Alloc, G>& rhs) {
   return !(lhs < rhs);
 }
 // !SECTION: relational operators
@@ -951,15 +1896,70 @@ bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
  *
  * @tparam T
  * @tparam Alloc
+ * @tparam G growth policy
  * @param x
  * @param y
  */
-template <typename T, typename Alloc>
-void swap(vector<T, Alloc>& x, vector<T, Alloc>& y) {
+template <typename T, typename Alloc, typename G>
+void swap(vector<T, Alloc, G>& x, vector<T, Alloc, G>& y) {
   x.swap(y);
 }
+
+// BASIC
+/**
+ * @brief pred 가 true 인 element 를 한 번에 지운다. (std::erase_if)
+ *
+ * @return 지운 element 의 수
+ */
+template <typename T, typename Alloc, typename G, typename Predicate>
+typename vector<T, Alloc, G>::size_type erase_if(vector<T, Alloc, G>& c,
+                                                 Predicate pred) {
+  return c.erase_if(pred);
+}
+
+/**
+ * @brief [first, last) 의 vector 들을 순서대로 fd 에 쓴다.
+ * vector 마다 write 하지 않고 writev 한 번에 최대 _kIovBatch 개씩 모아 쓴다.
+ * element 는 trivially copyable 해야 한다.
+ *
+ * @tparam InputIt vector 를 가리키는 iterator (vector*, vector<vector<char>
+ * >::iterator 등)
+ * @return ssize_t 쓴 byte 수. 실패하면 -1 (errno)
+ */
+template <typename InputIt>
+ssize_t write_to_fd(int fd, InputIt first, InputIt last) {
+  typedef typename iterator_traits<InputIt>::value_type container;
+  typedef typename container::value_type value_type;
+  _require_bitwise_io(is_trivially_copyable<value_type>());
+  struct iovec iov[_kIovBatch];
+  ssize_t total = 0;
+  while (first != last) {
+    int count = 0;
+    for (; first != last && count < _kIovBatch; ++first) {
+      if (first->empty()) {
+        continue;
+      }
+      iov[count].iov_base =
+          const_cast<void*>(static_cast<const void*>(&*first->begin()));
+      iov[count].iov_len = first->size() * sizeof(value_type);
+      ++count;
+    }
+    const ssize_t n = _writev_all(fd, iov, count);
+    if (n < 0) {
+      return -1;
+    }
+    total += n;
+  }
+  return total;
+}
 // !SECTION: non-member function of vector operator
+
+// 빈 vector 는 storage 가 없고 swap 은 pointer 만 바꾼다.
+template <typename T, typename Alloc, typename G>
+struct is_swap_relocatable<vector<T, Alloc, G> > : public true_type {};
 // !SECTION: vector
 }  // namespace ft
 
+#include "vector_bool.hpp"  // vector<bool> 특수화
+
 #endif  // VECTOR_HPP
@@ -0,0 +1,899 @@
+/**
+ * @file vector_bool.hpp
+ * @author jiskim
+ * @brief bit packed vector<bool>
+ * @date 2023-02-20
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef VECTOR_BOOL_HPP
+#define VECTOR_BOOL_HPP
+
+#include <climits>    // CHAR_BIT
+#include <stdexcept>  // out_of_range, invalid_argument
+
+#include "vector.hpp"
+
+namespace ft {
+
+// SECTION: bit word
+typedef unsigned long _bit_word;
+
+const size_t _word_bits = sizeof(_bit_word) * CHAR_BIT;
+
+/**
+ * @brief word 안의 1 인 bit 의 수. GCC, clang 은 popcnt 명령어를 쓰는
+ * builtin 을 사용한다. (-mpopcnt 가 없으면 libgcc 의 table 구현)
+ */
+inline size_t _popcount(_bit_word w) {
+#if defined(__GNUC__)
+  return __builtin_popcountl(w);
+#else
+  size_t n = 0;
+  for (; w != 0; w &= w - 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+
+/**
+ * @brief 가장 낮은 1 인 bit 의 위치. w 가 0 이면 안된다.
+ */
+inline size_t _count_trailing_zeros(_bit_word w) {
+#if defined(__GNUC__)
+  return __builtin_ctzl(w);
+#else
+  size_t n = 0;
+  for (; (w & 1) == 0; w >>= 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+// !SECTION: bit word
+
+// SECTION: bit reference
+/**
+ * @brief vector<bool> 의 bit 하나를 가리키는 proxy.
+ * bool 로 변환되고 bool 을 대입할 수 있다.
+ */
+struct _bit_reference {
+  _bit_word* _p;
+  _bit_word _mask;
+
+  _bit_reference(void) : _p(NULL), _mask(0) {}
+  _bit_reference(_bit_word* p, _bit_word mask) : _p(p), _mask(mask) {}
+
+  operator bool(void) const { return (*_p & _mask) != 0; }
+
+  _bit_reference& operator=(bool x) {
+    if (x) {
+      *_p |= _mask;
+    } else {
+      *_p &= ~_mask;
+    }
+    return *this;
+  }
+
+  // 가리키는 bit 가 아니라 값을 대입한다.
+  _bit_reference& operator=(const _bit_reference& x) {
+    return *this = static_cast<bool>(x);
+  }
+
+  bool operator==(const _bit_reference& x) const {
+    return static_cast<bool>(*this) == static_cast<bool>(x);
+  }
+
+  bool operator<(const _bit_reference& x) const {
+    return !static_cast<bool>(*this) && static_cast<bool>(x);
+  }
+
+  bool operator~(void) const { return !static_cast<bool>(*this); }
+
+  void flip(void) { *_p ^= _mask; }
+};
+
+/**
+ * @brief proxy 가 가리키는 두 bit 의 값을 바꾼다.
+ * ft::swap(T&, T&) 는 proxy 자체를 바꾸므로 따로 정의한다.
+ */
+inline void swap(_bit_reference x, _bit_reference y) {
+  bool tmp = x;
+  x = y;
+  y = tmp;
+}
+// !SECTION: bit reference
+
+// SECTION: bit iterator
+/**
+ * @brief word pointer 와 word 안의 bit 위치로 bit 하나를 가리킨다.
+ */
+struct _bit_iterator_base {
+  _bit_word* _p;
+  size_t _offset;
+
+  _bit_iterator_base(_bit_word* p, size_t offset) : _p(p), _offset(offset) {}
+
+  void _bump_up(void) {
+    if (++_offset == _word_bits) {
+      _offset = 0;
+      ++_p;
+    }
+  }
+
+  void _bump_down(void) {
+    if (_offset-- == 0) {
+      _offset = _word_bits - 1;
+      --_p;
+    }
+  }
+
+  void _incr(ptrdiff_t i) {
+    const ptrdiff_t bits = static_cast<ptrdiff_t>(_word_bits);
+    ptrdiff_t n = i + static_cast<ptrdiff_t>(_offset);
+    _p += n / bits;
+    n %= bits;
+    if (n < 0) {
+      n += bits;
+      --_p;
+    }
+    _offset = static_cast<size_t>(n);
+  }
+};
+
+inline bool operator==(const _bit_iterator_base& lhs,
+                       const _bit_iterator_base& rhs) {
+  return lhs._p == rhs._p && lhs._offset == rhs._offset;
+}
+
+inline bool operator!=(const _bit_iterator_base& lhs,
+                       const _bit_iterator_base& rhs) {
+  return !(lhs == rhs);
+}
+
+inline bool operator<(const _bit_iterator_base& lhs,
+                      const _bit_iterator_base& rhs) {
+  return lhs._p < rhs._p || (lhs._p == rhs._p && lhs._offset < rhs._offset);
+}
+
+inline bool operator>(const _bit_iterator_base& lhs,
+                      const _bit_iterator_base& rhs) {
+  return rhs < lhs;
+}
+
+inline bool operator<=(const _bit_iterator_base& lhs,
+                       const _bit_iterator_base& rhs) {
+  return !(rhs < lhs);
+}
+
+inline bool operator>=(const _bit_iterator_base& lhs,
+                       const _bit_iterator_base& rhs) {
+  return !(lhs < rhs);
+}
+
+inline ptrdiff_t operator-(const _bit_iterator_base& lhs,
+                           const _bit_iterator_base& rhs) {
+  return static_cast<ptrdiff_t>(_word_bits) * (lhs._p - rhs._p) +
+         static_cast<ptrdiff_t>(lhs._offset) -
+         static_cast<ptrdiff_t>(rhs._offset);
+}
+
+struct _bit_iterator : public _bit_iterator_base {
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef bool value_type;
+  typedef ptrdiff_t difference_type;
+  typedef _bit_reference* pointer;
+  typedef _bit_reference reference;
+  typedef _bit_iterator self;
+
+  _bit_iterator(void) : _bit_iterator_base(NULL, 0) {}
+  _bit_iterator(_bit_word* p, size_t offset) : _bit_iterator_base(p, offset) {}
+
+  reference operator*(void) const {
+    return reference(_p, static_cast<_bit_word>(1) << _offset);
+  }
+
+  self& operator++(void) {
+    _bump_up();
+    return *this;
+  }
+  self operator++(int) {
+    self tmp = *this;
+    _bump_up();
+    return tmp;
+  }
+
+  self& operator--(void) {
+    _bump_down();
+    return *this;
+  }
+  self operator--(int) {
+    self tmp = *this;
+    _bump_down();
+    return tmp;
+  }
+
+  self& operator+=(difference_type n) {
+    _incr(n);
+    return *this;
+  }
+  self& operator-=(difference_type n) {
+    _incr(-n);
+    return *this;
+  }
+
+  self operator+(difference_type n) const {
+    self tmp = *this;
+    return tmp += n;
+  }
+  self operator-(difference_type n) const {
+    self tmp = *this;
+    return tmp -= n;
+  }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+};
+
+inline _bit_iterator operator+(ptrdiff_t n, const _bit_iterator& it) {
+  return it + n;
+}
+
+struct _bit_const_iterator : public _bit_iterator_base {
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef bool value_type;
+  typedef ptrdiff_t difference_type;
+  typedef const bool* pointer;
+  typedef bool reference;
+  typedef _bit_const_iterator self;
+
+  _bit_const_iterator(void) : _bit_iterator_base(NULL, 0) {}
+  _bit_const_iterator(_bit_word* p, size_t offset)
+      : _bit_iterator_base(p, offset) {}
+  _bit_const_iterator(const _bit_iterator& it)
+      : _bit_iterator_base(it._p, it._offset) {}
+
+  reference operator*(void) const {
+    return (*_p & (static_cast<_bit_word>(1) << _offset)) != 0;
+  }
+
+  self& operator++(void) {
+    _bump_up();
+    return *this;
+  }
+  self operator++(int) {
+    self tmp = *this;
+    _bump_up();
+    return tmp;
+  }
+
+  self& operator--(void) {
+    _bump_down();
+    return *this;
+  }
+  self operator--(int) {
+    self tmp = *this;
+    _bump_down();
+    return tmp;
+  }
+
+  self& operator+=(difference_type n) {
+    _incr(n);
+    return *this;
+  }
+  self& operator-=(difference_type n) {
+    _incr(-n);
+    return *this;
+  }
+
+  self operator+(difference_type n) const {
+    self tmp = *this;
+    return tmp += n;
+  }
+  self operator-(difference_type n) const {
+    self tmp = *this;
+    return tmp -= n;
+  }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+};
+
+inline _bit_const_iterator operator+(ptrdiff_t n,
+                                     const _bit_const_iterator& it) {
+  return it + n;
+}
+// !SECTION: bit iterator
+
+// SECTION: vector<bool>
+/**
+ * @brief bool 하나를 bit 하나로 저장하는 vector 특수화.
+ * bit 는 unsigned long word 의 ft::vector 에 들어가므로 allocator, growth
+ * policy, 0 page 초기화는 일반 vector 와 같다. element 는 proxy
+ * (_bit_reference) 로 접근하므로 &v[0] 으로 bool* 를 얻을 수 없다.
+ *
+ * 마지막 word 의 size 를 넘는 bit 는 항상 0 으로 유지한다. 그래서 count,
+ * find_first, operator== 는 word 단위로 비교하고 bit 를 하나씩 보지 않는다.
+ *
+ * @tparam Alloc bool 의 allocator. word 의 allocator 로 rebind 해서 쓴다.
+ * @tparam GrowthPolicy word 단위로 capacity 를 정한다.
+ */
+template <typename Alloc, typename GrowthPolicy>
+class vector<bool, Alloc, GrowthPolicy> {
+ public:
+  typedef bool value_type;
+  typedef Alloc allocator_type;
+  typedef GrowthPolicy growth_policy;
+  typedef _bit_reference reference;
+  typedef bool const_reference;
+  typedef _bit_reference* pointer;
+  typedef const bool* const_pointer;
+
+  typedef _bit_iterator iterator;
+  typedef _bit_const_iterator const_iterator;
+
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+  // find_first, find_next 가 찾지 못했을 때 리턴한다.
+  static const size_type npos = static_cast<size_type>(-1);
+
+ private:
+  typedef typename Alloc::template rebind<_bit_word>::other _word_allocator;
+  typedef vector<_bit_word, _word_allocator, GrowthPolicy> _word_vector;
+
+  _word_vector _words;
+  size_type _size;
+
+ public:
+  // SECTION: constructor and destructor
+  // STRONG
+  explicit vector(const allocator_type& alloc = allocator_type())
+      : _words(_word_allocator(alloc)), _size(0) {}
+
+  // false 로 채울 때는 0 word 로 채우므로 0 page 를 그대로 쓴다.
+  explicit vector(size_type n, const value_type& val = value_type(),
+                  const allocator_type& alloc = allocator_type())
+      : _words(_word_count(n), _fill_word(val), _word_allocator(alloc)),
+        _size(n) {
+    _clear_tail();
+  }
+
+  template <typename InputIterator>
+  vector(InputIterator first,
+         typename enable_if<is_input_iterator<InputIterator>::value &&
+                                !is_forward_iterator<InputIterator>::value,
+                            InputIterator>::type last,
+         const allocator_type& alloc = allocator_type())
+      : _words(_word_allocator(alloc)), _size(0) {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  template <typename ForwardIterator>
+  vector(ForwardIterator first,
+         typename enable_if<is_forward_iterator<ForwardIterator>::value,
+                            ForwardIterator>::type last,
+         const allocator_type& alloc = allocator_type())
+      : _words(_word_count(std::distance(first, last)), 0,
+               _word_allocator(alloc)),
+        _size(std::distance(first, last)) {
+    _copy_bits(first, last, begin());
+  }
+
+  vector(const vector& x) : _words(x._words), _size(x._size) {}
+
+#if FT_HAS_MOVE
+  // NOTHROW
+  vector(vector&& x) noexcept : _words(std::move(x._words)), _size(x._size) {
+    x._size = 0;
+  }
+#endif
+
+  // NOTHROW
+  ~vector(void) {}
+  // !SECTION: constructor and destructor
+
+  // BASIC
+  vector& operator=(const vector& x) {
+    if (this != &x) {
+      _words = x._words;
+      _size = x._size;
+    }
+    return *this;
+  }
+
+#if FT_HAS_MOVE
+  // NOTHROW
+  vector& operator=(vector&& x) noexcept {
+    vector tmp(std::move(x));
+    swap(tmp);
+    return *this;
+  }
+#endif
+
+  // SECTION: iterator
+  iterator begin(void) { return iterator(_words.data(), 0); }
+  const_iterator begin(void) const {
+    return const_iterator(const_cast<_bit_word*>(_words.data()), 0);
+  }
+
+  iterator end(void) { return begin() + static_cast<difference_type>(_size); }
+  const_iterator end(void) const {
+    return begin() + static_cast<difference_type>(_size);
+  }
+
+  reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin(void) const {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend(void) { return reverse_iterator(begin()); }
+  const_reverse_iterator rend(void) const {
+    return const_reverse_iterator(begin());
+  }
+  // !SECTION: iterator
+
+  // SECTION: capacity
+  size_type size(void) const { return _size; }
+
+  size_type max_size(void) const {
+    const size_type words = _words.max_size();
+    return words > npos / _word_bits ? npos : words * _word_bits;
+  }
+
+  // STRONG n > size and reallocation required
+  // BASIC otherwise
+  void resize(size_type n, value_type val = value_type()) {
+    if (n > _size) {
+      insert(end(), n - _size, val);
+    } else {
+      _truncate(n);
+    }
+  }
+
+  size_type capacity(void) const { return _words.capacity() * _word_bits; }
+
+  bool empty(void) const { return _size == 0; }
+
+  // STRONG
+  void reserve(size_type n) { _words.reserve(_word_count(n)); }
+
+  // STRONG
+  void shrink_to_fit(void) { _words.shrink_to_fit(); }
+  // !SECTION: capacity
+
+  // SECTION: element access
+  // NOTHROW size > n
+  // otherwise UB
+  reference operator[](size_type n) { return begin()[n]; }
+  const_reference operator[](size_type n) const { return begin()[n]; }
+
+  // STRONG
+  reference at(size_type n) {
+    if (n >= _size) {
+      throw std::out_of_range("ft::vector::at n is out of range.");
+    }
+    return (*this)[n];
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= _size) {
+      throw std::out_of_range("ft::vector::at n is out of range.");
+    }
+    return (*this)[n];
+  }
+
+  // NOTHROW container is not empty
+  // otherwise UB
+  reference front(void) { return *begin(); }
+  const_reference front(void) const { return *begin(); }
+
+  reference back(void) { return *(end() - 1); }
+  const_reference back(void) const { return *(end() - 1); }
+  // !SECTION: element access
+
+  // SECTION: modifiers
+  // BASIC
+  template <typename InputIterator>
+  void assign(InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  // BASIC
+  void assign(size_type n, const value_type& val) {
+    _words.assign(_word_count(n), _fill_word(val));
+    _size = n;
+    _clear_tail();
+  }
+
+  // STRONG
+  void push_back(const value_type& val) {
+    if (_size % _word_bits == 0) {
+      _words.push_back(0);
+    }
+    ++_size;
+    if (val) {
+      back() = true;
+    }
+  }
+
+  // NOTHROW container is not empty
+  // otherwise UB
+  void pop_back(void) { _truncate(_size - 1); }
+
+  // STRONG insert at the end
+  // BASIC otherwise
+  iterator insert(iterator position, const value_type& val) {
+    const difference_type offset = position - begin();
+    insert(position, 1, val);
+    return begin() + offset;
+  }
+
+  /**
+   * @brief position 앞에 val 을 n 개 삽입한다. 뒤의 bit 를 n 만큼 밀고 새
+   * 영역은 word 단위로 채운다.
+   * @complexity O(N + n / word bits) N 은 position 뒤의 bit 수
+   */
+  void insert(iterator position, size_type n, const value_type& val) {
+    if (n == 0) {
+      return;
+    }
+    const size_type offset = position - begin();
+    const size_type old_size = _size;
+    _grow(_size + n);
+    _copy_bits_backward(begin() + offset, begin() + old_size, end());
+    _fill_bits(offset, offset + n, val);
+  }
+
+  // BASIC
+  template <typename InputIterator>
+  void insert(iterator position, InputIterator first,
+              typename enable_if<is_input_iterator<InputIterator>::value &&
+                                     !is_forward_iterator<InputIterator>::value,
+                                 InputIterator>::type last) {
+    // 길이를 모르므로 bit 로 모은 뒤 한 번에 민다.
+    const vector tmp(first, last, get_allocator());
+    insert(position, tmp.begin(), tmp.end());
+  }
+
+  template <typename ForwardIterator>
+  void insert(iterator position, ForwardIterator first,
+              typename enable_if<is_forward_iterator<ForwardIterator>::value,
+                                 ForwardIterator>::type last) {
+    const size_type n = std::distance(first, last);
+    if (n == 0) {
+      return;
+    }
+    const size_type offset = position - begin();
+    const size_type old_size = _size;
+    _grow(_size + n);
+    _copy_bits_backward(begin() + offset, begin() + old_size, end());
+    _copy_bits(first, last, begin() + offset);
+  }
+
+  // BASIC
+  iterator erase(iterator position) { return erase(position, position + 1); }
+
+  iterator erase(iterator first, iterator last) {
+    const difference_type offset = first - begin();
+    if (first != last) {
+      _copy_bits(const_iterator(last), const_iterator(end()), first);
+      _truncate(_size - (last - first));
+    }
+    return begin() + offset;
+  }
+
+  // NOTHROW if pred does not throw
+  /**
+   * @brief pred 가 true 인 bit 를 모두 지운다. 남는 bit 는 한 번에 앞으로
+   * 모은다.
+   * @return size_type 지운 bit 의 수
+   */
+  template <typename Predicate>
+  size_type erase_if(Predicate pred) {
+    iterator dest = begin();
+    for (iterator it = begin(); it != end(); ++it) {
+      const bool bit = *it;
+      if (!pred(bit)) {
+        *dest = bit;
+        ++dest;
+      }
+    }
+    const size_type n = end() - dest;
+    _truncate(_size - n);
+    return n;
+  }
+
+  // NOTHROW
+  /**
+   * @brief 오름차순으로 정렬된 index 의 bit 들을 지운다. (vector::erase_indices)
+   * @return size_type 지운 bit 의 수
+   */
+  template <typename InputIterator>
+  size_type erase_indices(
+      InputIterator first,
+      typename enable_if<is_input_iterator<InputIterator>::value,
+                         InputIterator>::type last) {
+    if (first == last) {
+      return 0;
+    }
+    iterator dest = begin() + *first;
+    iterator src = dest;
+    for (; first != last; ++first) {
+      iterator victim = begin() + *first;
+      for (; src < victim; ++src, ++dest) {
+        *dest = *src;
+      }
+      if (src == victim) {
+        ++src;
+      }
+    }
+    for (; src != end(); ++src, ++dest) {
+      *dest = *src;
+    }
+    const size_type n = end() - dest;
+    _truncate(_size - n);
+    return n;
+  }
+
+  // NOTHROW
+  void swap(vector& x) {
+    _words.swap(x._words);
+    ft::swap(_size, x._size);
+  }
+
+  /**
+   * @brief 두 proxy 가 가리키는 bit 를 바꾼다. (std::vector<bool>::swap)
+   */
+  static void swap(reference x, reference y) {
+    bool tmp = x;
+    x = y;
+    y = tmp;
+  }
+
+  // NOTHROW
+  void clear(void) {
+    _words.clear();
+    _size = 0;
+  }
+
+  // NOTHROW
+  /**
+   * @brief 모든 bit 를 뒤집는다.
+   * @complexity O(size / word bits)
+   */
+  void flip(void) {
+    _bit_word* w = _words.data();
+    const size_type n = _words.size();
+    for (size_type i = 0; i < n; ++i) {
+      w[i] = ~w[i];
+    }
+    _clear_tail();
+  }
+  // !SECTION: modifiers
+
+  // SECTION: bit operations
+  // word 단위로 동작하는 연산. word loop 는 단순한 형태라서 -O2 이상이면
+  // 컴파일러가 SIMD 로 vectorize 할 수 있다.
+
+  // NOTHROW
+  /**
+   * @brief true 인 element 의 수
+   * @complexity O(size / word bits)
+   */
+  size_type count(void) const {
+    const _bit_word* w = _words.data();
+    const size_type n = _words.size();
+    size_type total = 0;
+    for (size_type i = 0; i < n; ++i) {
+      total += _popcount(w[i]);
+    }
+    return total;
+  }
+
+  // NOTHROW
+  /**
+   * @brief 처음으로 true 인 element 의 위치. 없으면 npos
+   * @complexity O(size / word bits)
+   */
+  size_type find_first(void) const { return _find_from(0); }
+
+  // NOTHROW
+  /**
+   * @brief pos 보다 뒤에서 처음으로 true 인 element 의 위치. 없으면 npos
+   *
+   * @param pos 이 위치 다음부터 찾는다.
+   */
+  size_type find_next(size_type pos) const {
+    if (pos >= _size || pos + 1 == _size) {
+      return npos;
+    }
+    return _find_from(pos + 1);
+  }
+
+  // STRONG
+  // size 가 다르면 invalid_argument 를 던진다.
+  /**
+   * @brief word 단위 AND, OR, XOR. 두 vector 의 size 는 같아야 한다.
+   * @complexity O(size / word bits)
+   */
+  vector& operator&=(const vector& x) {
+    _check_same_size(x);
+    _bit_word* w = _words.data();
+    const _bit_word* xw = x._words.data();
+    const size_type n = _words.size();
+    for (size_type i = 0; i < n; ++i) {
+      w[i] &= xw[i];
+    }
+    return *this;
+  }
+
+  vector& operator|=(const vector& x) {
+    _check_same_size(x);
+    _bit_word* w = _words.data();
+    const _bit_word* xw = x._words.data();
+    const size_type n = _words.size();
+    for (size_type i = 0; i < n; ++i) {
+      w[i] |= xw[i];
+    }
+    return *this;
+  }
+
+  vector& operator^=(const vector& x) {
+    _check_same_size(x);
+    _bit_word* w = _words.data();
+    const _bit_word* xw = x._words.data();
+    const size_type n = _words.size();
+    for (size_type i = 0; i < n; ++i) {
+      w[i] ^= xw[i];
+    }
+    return *this;
+  }
+  // !SECTION: bit operations
+
+  allocator_type get_allocator(void) const {
+    return allocator_type(_words.get_allocator());
+  }
+
+  template <typename A, typename G>
+  friend bool operator==(const vector<bool, A, G>& lhs,
+                         const vector<bool, A, G>& rhs);
+
+  // SECTION: private functions
+ private:
+  static size_type _word_count(size_type bits) {
+    return bits / _word_bits + (bits % _word_bits != 0);
+  }
+
+  static _bit_word _fill_word(bool val) {
+    return val ? ~static_cast<_bit_word>(0) : 0;
+  }
+
+  /**
+   * @brief 마지막 word 의 size 를 넘는 bit 를 0 으로 만든다.
+   */
+  void _clear_tail(void) {
+    const size_type used = _size % _word_bits;
+    if (used != 0) {
+      _words.back() &= (static_cast<_bit_word>(1) << used) - 1;
+    }
+  }
+
+  /**
+   * @brief size 를 n (>= size) 으로 늘린다. 새 bit 는 0 이다.
+   */
+  void _grow(size_type n) {
+    _words.resize(_word_count(n), 0);
+    _size = n;
+  }
+
+  /**
+   * @brief size 를 n (<= size) 으로 줄인다.
+   */
+  void _truncate(size_type n) {
+    _words.resize(_word_count(n));
+    _size = n;
+    _clear_tail();
+  }
+
+  /**
+   * @brief [first, last) bit 를 val 로 채운다. 양 끝의 word 만 mask 로
+   * 처리하고 가운데 word 는 통째로 대입한다.
+   */
+  void _fill_bits(size_type first, size_type last, bool val) {
+    const _bit_word fill = _fill_word(val);
+    _bit_word* w = _words.data();
+    size_type idx = first / _word_bits;
+    const size_type last_idx = last / _word_bits;
+    const _bit_word head = ~static_cast<_bit_word>(0) << (first % _word_bits);
+    const _bit_word tail =
+        (static_cast<_bit_word>(1) << (last % _word_bits)) - 1;
+    if (idx == last_idx) {
+      _assign_masked(w[idx], head & tail, fill);
+      return;
+    }
+    _assign_masked(w[idx], head, fill);
+    for (++idx; idx < last_idx; ++idx) {
+      w[idx] = fill;
+    }
+    if (tail != 0) {
+      _assign_masked(w[last_idx], tail, fill);
+    }
+  }
+
+  static void _assign_masked(_bit_word& w, _bit_word mask, _bit_word fill) {
+    w = (w & ~mask) | (fill & mask);
+  }
+
+  size_type _find_from(size_type pos) const {
+    const _bit_word* w = _words.data();
+    const size_type n = _words.size();
+    size_type idx = pos / _word_bits;
+    if (idx >= n) {
+      return npos;
+    }
+    _bit_word cur = w[idx] & (~static_cast<_bit_word>(0) << (pos % _word_bits));
+    while (cur == 0) {
+      if (++idx == n) {
+        return npos;
+      }
+      cur = w[idx];
+    }
+    return idx * _word_bits + _count_trailing_zeros(cur);
+  }
+
+  void _check_same_size(const vector& x) const {
+    if (_size != x._size) {
+      throw std::invalid_argument("ft::vector<bool> : size mismatch");
+    }
+  }
+
+  /**
+   * @brief [first, last) 를 dest 부터 앞에서 차례로 대입한다.
+   * 범위가 겹치면 dest 가 first 보다 앞이어야 한다. (erase)
+   */
+  template <typename InputIterator>
+  static iterator _copy_bits(InputIterator first, InputIterator last,
+                             iterator dest) {
+    for (; first != last; ++first, ++dest) {
+      *dest = static_cast<bool>(*first);
+    }
+    return dest;
+  }
+
+  /**
+   * @brief [first, last) 를 dest_last 에서 끝나도록 뒤에서부터 대입한다.
+   * (insert 의 shift)
+   */
+  static void _copy_bits_backward(const_iterator first, const_iterator last,
+                                  iterator dest_last) {
+    while (first != last) {
+      *--dest_last = *--last;
+    }
+  }
+  // !SECTION: private functions
+};
+
+template <typename Alloc, typename G>
+const typename vector<bool, Alloc, G>::size_type vector<bool, Alloc, G>::npos;
+
+/**
+ * @brief 마지막 word 의 남는 bit 가 0 이므로 word 단위로 비교한다.
+ */
+template <typename Alloc, typename G>
+bool operator==(const vector<bool, Alloc, G>& lhs,
+                const vector<bool, Alloc, G>& rhs) {
+  return lhs._size == rhs._size && lhs._words == rhs._words;
+}
+// !SECTION: vector<bool>
+
+}  // namespace ft
+
+#endif  // VECTOR_BOOL_HPP
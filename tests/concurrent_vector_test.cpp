@@ -0,0 +1,92 @@
+/**
+ * @file concurrent_vector_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-22
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "concurrent_vector.hpp"
+
+#include <pthread.h>
+
+#include <iostream>
+#include <string>
+
+#include "testheader/vector_test.hpp"
+
+namespace {
+
+const int kThreads = 4;
+const int kPerThread = 10000;
+
+void* push_numbers(void* arg) {
+  ft::concurrent_vector<int>* v = static_cast<ft::concurrent_vector<int>*>(arg);
+  for (int i = 0; i < kPerThread; ++i) {
+    v->push_back(i);
+  }
+  v->grow_by(10, -1);
+  return NULL;
+}
+
+}  // namespace
+
+void concurrent_vector_test(void) {
+  std::cout << "\n\n============= concurrent_vector segment test "
+               "==============\n";
+  {
+    ft::concurrent_vector<std::string> strs;
+    strs.push_back("first");
+    const std::string* first = &strs[0];
+    for (int i = 0; i < 100; ++i) {
+      strs.push_back("item");
+      if (i % 20 == 0) {
+        std::cout << "size : " << strs.size()
+                  << ", capacity : " << strs.capacity() << '\n';
+      }
+    }
+    ft::concurrent_vector<std::string>::iterator it = strs.grow_by(3, "grow");
+    std::cout << "grow_by index : " << it - strs.begin()
+              << ", same address : " << std::boolalpha
+              << (first == &strs.front()) << ", back : " << strs.back()
+              << '\n';
+    print_vector(strs.begin() + 98, strs.end());
+  }
+
+  std::cout << "\n\n============= concurrent_vector threads test "
+               "==============\n";
+  {
+    ft::concurrent_vector<int> v;
+    pthread_t workers[kThreads];
+    for (int i = 0; i < kThreads; ++i) {
+      pthread_create(&workers[i], NULL, push_numbers, &v);
+    }
+    for (int i = 0; i < kThreads; ++i) {
+      pthread_join(workers[i], NULL);
+    }
+    long sum = 0;
+    int grown = 0;
+    for (ft::concurrent_vector<int>::const_iterator it = v.begin();
+         it != v.end(); ++it) {
+      if (*it == -1) {
+        ++grown;
+      } else {
+        sum += *it;
+      }
+    }
+    std::cout << "size : " << v.size() << ", sum : " << sum
+              << ", grown : " << grown << '\n';
+
+    ft::concurrent_vector<int> copy(v);
+    std::cout << "copy == v : " << (copy == v) << '\n';
+    copy.clear();
+    std::cout << "after clear : " << copy.size() << ", empty : "
+              << copy.empty() << '\n';
+    try {
+      copy.at(0);
+    } catch (const std::exception& e) {
+      std::cout << e.what() << '\n';
+    }
+  }
+}
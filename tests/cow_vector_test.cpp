@@ -0,0 +1,67 @@
+/**
+ * @file cow_vector_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "cow_vector.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "stack.hpp"
+#include "testheader/vector_test.hpp"
+
+void cow_vector_test(void) {
+  std::cout << "\n\n============= cow_vector share test ==============\n";
+  {
+    ft::cow_vector<std::string> a(3, "abc");
+    ft::cow_vector<std::string> b(a);
+    // 읽기만 할 때는 const 로 접근해야 공유가 유지된다.
+    const ft::cow_vector<std::string>& ca = a;
+    const ft::cow_vector<std::string>& cb = b;
+    std::cout << "shared : " << a.is_shared() << ", use_count : "
+              << a.use_count() << ", same data : " << (ca.data() == cb.data())
+              << '\n';
+    // 처음 수정할 때 복사한다.
+    b.push_back("def");
+    std::cout << "after push_back shared : " << a.is_shared()
+              << ", a size : " << a.size() << ", b size : " << b.size()
+              << '\n';
+    print_vector(b.begin(), b.end());
+  }
+
+  std::cout << "\n\n============= cow_vector reference test "
+               "==============\n";
+  {
+    ft::cow_vector<int> a(4, 1);
+    int& first = a[0];
+    ft::cow_vector<int> b(a);
+    first = 42;
+    // 수정 가능한 reference 를 내준 storage 는 복사할 때 공유하지 않는다.
+    const ft::cow_vector<int>& cb = b;
+    std::cout << "a[0] : " << first << ", b[0] : " << cb[0]
+              << ", shared : " << a.is_shared() << '\n';
+    ft::cow_vector<int> c(b);
+    std::cout << "use_count : " << b.use_count() << '\n';
+    c.unshare();
+    std::cout << "after unshare : " << b.use_count() << ", "
+              << c.use_count() << ", equal : " << (b == c) << '\n';
+  }
+
+  std::cout << "\n\n============= cow_vector stack test "
+               "==============\n";
+  {
+    ft::stack<int, ft::cow_vector<int> > s;
+    for (int i = 0; i < 5; ++i) {
+      s.push(i);
+    }
+    ft::stack<int, ft::cow_vector<int> > copy(s);
+    copy.pop();
+    std::cout << "s top : " << s.top() << ", copy top : " << copy.top()
+              << ", s size : " << s.size() << '\n';
+  }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file deque_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-21
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "deque.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "stack.hpp"
+#include "testheader/vector_test.hpp"
+
+void deque_test(void) {
+  std::cout << "\n\n============= deque push/pop test ==============\n";
+  {
+    ft::deque<int> d;
+    for (int i = 0; i < 5; ++i) {
+      d.push_back(i);
+      d.push_front(-i - 1);
+    }
+    print_vector(d.begin(), d.end());
+    d.pop_front();
+    d.pop_back();
+    std::cout << "size : " << d.size() << ", front : " << d.front()
+              << ", back : " << d.back() << ", d[3] : " << d[3] << '\n';
+    print_vector(d.rbegin(), d.rend());
+  }
+
+  std::cout << "\n\n============= deque reference stability test "
+               "==============\n";
+  {
+    ft::deque<std::string> strs(1, "first");
+    const std::string* first = &strs.front();
+    for (int i = 0; i < 5000; ++i) {
+      strs.push_back("back");
+      strs.push_front("front");
+    }
+    std::cout << "size : " << strs.size() << ", same address : "
+              << std::boolalpha << (first == &strs[5000])
+              << ", value : " << *first << '\n';
+  }
+
+  std::cout << "\n\n============= deque insert/erase test ==============\n";
+  {
+    ft::deque<int> d;
+    for (int i = 0; i < 10; ++i) {
+      d.push_back(i);
+    }
+    d.insert(d.begin() + 2, 3, 42);
+    d.insert(d.end() - 1, 7);
+    print_vector(d.begin(), d.end());
+    d.erase(d.begin() + 1, d.begin() + 4);
+    d.erase(d.end() - 3);
+    print_vector(d.begin(), d.end());
+    d.resize(4);
+    ft::deque<int> copy(d);
+    std::cout << "copy == d : " << (copy == d) << ", copy < d : " << (copy < d)
+              << '\n';
+    try {
+      d.at(100);
+    } catch (const std::exception& e) {
+      std::cout << e.what() << '\n';
+    }
+  }
+
+  std::cout << "\n\n============= stack<T, deque<T> > test ==============\n";
+  {
+    ft::stack<int, ft::deque<int> > stack;
+    for (int i = 0; i < 10; ++i) {
+      stack.push(i * i);
+    }
+    while (!stack.empty()) {
+      std::cout << stack.top() << ", ";
+      stack.pop();
+    }
+    std::cout << '\n';
+  }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file incremental_vector_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-17
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "incremental_vector.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "stack.hpp"
+#include "testheader/vector_test.hpp"
+
+void incremental_vector_test(void) {
+  std::cout
+      << "\n\n============= incremental_vector migration test ==============\n";
+  {
+    ft::incremental_vector<int> v;
+    for (int i = 0; i < 20; ++i) {
+      v.push_back(i);
+      std::cout << "size : " << v.size() << ", capacity : " << v.capacity()
+                << ", migrating : " << std::boolalpha << v.is_migrating()
+                << '\n';
+    }
+    print_vector(v.begin(), v.end());
+    print_vector(v);
+    v.pop_back();
+    std::cout << "front : " << v.front() << ", back : " << v.back()
+              << ", v[10] : " << v[10] << '\n';
+  }
+
+  std::cout
+      << "\n\n============= incremental_vector copy test ==============\n";
+  {
+    ft::incremental_vector<std::string> strs;
+    for (int i = 0; i < 9; ++i) {
+      strs.push_back(std::string(i + 1, 'a' + i));
+    }
+    ft::incremental_vector<std::string> copy(strs);
+    std::cout << "migrating : " << strs.is_migrating()
+              << ", copy migrating : " << copy.is_migrating()
+              << ", equal : " << (strs == copy) << '\n';
+    print_vector(copy.rbegin(), copy.rend());
+  }
+
+  std::cout
+      << "\n\n============= stack<incremental_vector> test ==============\n";
+  {
+    ft::stack<char, ft::incremental_vector<char> > stk;
+    for (char c = 'a'; c <= 'z'; ++c) {
+      stk.push(c);
+    }
+    while (!stk.empty()) {
+      std::cout << stk.top();
+      stk.pop();
+    }
+    std::cout << '\n';
+  }
+}
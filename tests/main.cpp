@@ -13,6 +13,15 @@ int main(void) {
   type_traits_test();
   vector_test();
   vector_iterator_test();
+  vector_bool_test();
+  small_vector_test();
+  incremental_vector_test();
+  deque_test();
+  concurrent_vector_test();
+  mapped_vector_test();
+  cow_vector_test();
+  soa_vector_test();
+  packed_vector_test();
   pair_test();
   tree_test();
   map_test();
@@ -10,9 +10,11 @@
 #include "map.hpp"
 
 #include <iostream>
+#include <vector>
 
 #include "math.h"
 #include "testheader/tree_test.hpp"
+#include "vector.hpp"
 
 #define NUM 1000
 #define RANGE 1000000
@@ -21,6 +23,37 @@ typedef ft::map<int, std::string> map_type;
 typedef map_type::value_type value_type;
 typedef map_type::iterator map_it;
 
+#if FT_HAS_MOVE
+// 복사된 횟수를 센다. vector 가 재할당할 때 map 을 move 하는지 확인한다.
+struct copy_counted {
+  static int copies;
+  int value;
+
+  copy_counted(int v = 0) : value(v) {}
+  copy_counted(const copy_counted& x) : value(x.value) { ++copies; }
+  copy_counted& operator=(const copy_counted& x) {
+    value = x.value;
+    ++copies;
+    return *this;
+  }
+};
+
+int copy_counted::copies = 0;
+
+typedef ft::map<int, copy_counted> counted_map;
+
+template <typename Vector>
+int copies_during_growth(const counted_map& m, int n) {
+  Vector v;
+  copy_counted::copies = 0;
+  for (int i = 0; i < n; ++i) {
+    v.push_back(m);
+  }
+  // push_back 한 번에 m 을 한 번 복사한다. 나머지는 재할당에서 생긴 복사.
+  return copy_counted::copies - n * static_cast<int>(m.size());
+}
+#endif
+
 void map_test(void) {
   map_type map;
   map_it it;
@@ -57,4 +90,31 @@ void map_test(void) {
 
   map_type map2(arr, arr + 10);
   print_rb_tree(map2.end());
+
+#if FT_HAS_MOVE
+  std::cout << "\n\n================================ map move test "
+               "================================\n\n";
+  map_type map3(std::move(map2));
+  std::cout << "moved size : " << map3.size()
+            << ", source size : " << map2.size() << '\n';
+  map2 = std::move(map3);
+  std::cout << "moved back size : " << map2.size()
+            << ", source size : " << map3.size() << '\n';
+  print_rb_tree(map2.end());
+
+  std::cout << "\n\n================================ vector<map> growth test "
+               "================================\n\n";
+  counted_map counted;
+  for (int i = 0; i < 10; ++i) {
+    counted[i] = copy_counted(i);
+  }
+  std::cout << "nothrow movable : "
+            << std::is_nothrow_move_constructible<counted_map>::value << '\n';
+  std::cout << "ft::vector copies during growth : "
+            << copies_during_growth<ft::vector<counted_map> >(counted, 100)
+            << '\n';
+  std::cout << "std::vector copies during growth : "
+            << copies_during_growth<std::vector<counted_map> >(counted, 100)
+            << '\n';
+#endif
 }
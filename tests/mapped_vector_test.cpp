@@ -0,0 +1,68 @@
+/**
+ * @file mapped_vector_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "mapped_vector.hpp"
+
+#include <unistd.h>
+
+#include <iostream>
+
+#include "testheader/vector_test.hpp"
+
+void mapped_vector_test(void) {
+  const char* path = "/tmp/ft_mapped_vector_test.map";
+  unlink(path);
+
+  std::cout << "\n\n============= mapped_vector create test "
+               "==============\n";
+  {
+    ft::mapped_vector<int> table(path);
+    std::cout << "empty : " << table.empty()
+              << ", capacity > 0 : " << (table.capacity() > 0) << '\n';
+    for (int i = 0; i < 100000; ++i) {
+      table.push_back(i * 2);
+    }
+    table.insert(table.begin(), 3, -1);
+    table.erase(table.begin() + 3, table.begin() + 5);
+    table.resize(table.size() + 2, 7);
+    std::cout << "size : " << table.size() << ", front : " << table.front()
+              << ", [3] : " << table[3] << ", back : " << table.back()
+              << '\n';
+    print_vector(table.begin(), table.begin() + 6);
+    table.sync();
+  }
+
+  std::cout << "\n\n============= mapped_vector reopen test "
+               "==============\n";
+  {
+    // 다시 열면 element 를 다시 만들지 않고 file 에서 그대로 읽는다.
+    ft::mapped_vector<int> table(path);
+    std::cout << "size : " << table.size() << ", [3] : " << table[3]
+              << ", back : " << table.back() << '\n';
+    table.clear();
+    table.shrink_to_fit();
+    std::cout << "after clear : " << table.size()
+              << ", capacity < 100000 : " << (table.capacity() < 100000)
+              << '\n';
+    try {
+      table.at(0);
+    } catch (const std::out_of_range& e) {
+      std::cout << e.what() << '\n';
+    }
+  }
+
+  std::cout << "\n\n============= mapped_vector type mismatch test "
+               "==============\n";
+  try {
+    ft::mapped_vector<double> wrong(path);
+  } catch (const std::runtime_error& e) {
+    std::cout << e.what() << '\n';
+  }
+  unlink(path);
+}
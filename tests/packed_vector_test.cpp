@@ -0,0 +1,73 @@
+/**
+ * @file packed_vector_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-28
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "packed_vector.hpp"
+
+#include <iostream>
+
+#include "testheader/vector_test.hpp"
+
+void packed_vector_test(void) {
+  std::cout << "\n\n============= packed_vector fixed width test "
+               "==============\n";
+  {
+    ft::packed_vector<int> v;
+    for (int i = 0; i < 1000; ++i) {
+      v.push_back(i % 100);
+    }
+    // 값마다 7 bit 만 쓴다.
+    std::cout << "size : " << v.size()
+              << ", smaller than int[] : " << (v.memory_usage() < 1000 * 4)
+              << '\n';
+    // 폭에 들어가지 않는 값은 다시 pack 한다.
+    v.set(3, -70000);
+    v.push_back(1 << 30);
+    std::cout << "[3] : " << v[3] << ", [4] : " << v[4]
+              << ", back : " << v.back() << '\n';
+    int buf[8];
+    v.decode(95, 8, buf);
+    print_vector(buf, buf + 8);
+    try {
+      v.at(v.size());
+    } catch (const std::out_of_range& e) {
+      std::cout << e.what() << '\n';
+    }
+  }
+
+  std::cout << "\n\n============= packed_vector blocks test "
+               "==============\n";
+  {
+    // 전체 범위는 넓지만 block 안에서는 가까운 값
+    ft::vector<long> stamps;
+    for (long i = 0; i < 1000; ++i) {
+      stamps.push_back(1677000000000L + i * 37);
+    }
+    ft::packed_vector<long, ft::packed_blocks> v;
+    v.append(stamps.begin(), stamps.end());
+    ft::packed_vector<long> fixed(stamps.begin(), stamps.end());
+    std::cout << "size : " << v.size() << ", front : " << v.front()
+              << ", back : " << v.back() << ", smaller than fixed : "
+              << (v.memory_usage() < fixed.memory_usage()) << '\n';
+    v.set(500, -1);
+    v.pop_back();
+    std::cout << "[500] : " << v[500] << ", [501] : " << v[501]
+              << ", size : " << v.size() << '\n';
+    print_vector(v.begin() + 498, v.begin() + 503);
+  }
+
+  std::cout << "\n\n============= packed_vector compare test "
+               "==============\n";
+  {
+    ft::packed_vector<unsigned> a(10, 3);
+    ft::packed_vector<unsigned> b(a.begin(), a.end());
+    std::cout << "equal : " << (a == b);
+    b.resize(12, 5);
+    std::cout << ", less : " << (a < b) << ", b.back : " << b.back() << '\n';
+  }
+}
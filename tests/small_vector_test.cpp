@@ -0,0 +1,71 @@
+/**
+ * @file small_vector_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-13
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "small_vector.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "stack.hpp"
+#include "testheader/vector_test.hpp"
+
+// cache line 하나를 차지하는 타입. inline buffer 도 64 byte 로 정렬해야 한다.
+struct cache_line {
+  char data[64];
+} __attribute__((aligned(64)));
+
+void small_vector_test(void) {
+  std::cout << "\n\n============= small_vector inline test ==============\n";
+  {
+    ft::small_vector<int, 4> v;
+    for (int i = 0; i < 6; ++i) {
+      v.push_back(i);
+      std::cout << "size : " << v.size() << ", capacity : " << v.capacity()
+                << ", inline : " << std::boolalpha << v.is_inline() << '\n';
+    }
+    v.insert(v.begin() + 2, 3, 100);
+    v.erase(v.begin());
+    print_vector(v.begin(), v.end());
+    print_vector(v);
+  }
+
+  std::cout << "\n\n============= small_vector swap test ==============\n";
+  {
+    ft::small_vector<std::string, 2> inline_vec(2, "inline");
+    ft::small_vector<std::string, 2> heap_vec(5, "heap");
+    inline_vec.swap(heap_vec);
+    print_vector(inline_vec.begin(), inline_vec.end());
+    print_vector(heap_vec.begin(), heap_vec.end());
+    std::cout << "inline_vec is inline : " << inline_vec.is_inline()
+              << ", heap_vec is inline : " << heap_vec.is_inline() << '\n';
+  }
+
+  std::cout << "\n\n============= small_vector alignment test "
+               "==============\n";
+  {
+    ft::small_vector<char, 1> padding;
+    ft::small_vector<cache_line, 3> v(3);
+    std::cout << "inline : " << v.is_inline() << ", 64 byte aligned : "
+              << (reinterpret_cast<size_t>(&v[0]) % 64 == 0) << '\n';
+    (void)padding;
+  }
+
+  std::cout << "\n\n============= stack<small_vector> test ==============\n";
+  {
+    ft::stack<char, ft::small_vector<char, 16> > stk;
+    for (char c = 'a'; c <= 'z'; ++c) {
+      stk.push(c);
+    }
+    while (!stk.empty()) {
+      std::cout << stk.top();
+      stk.pop();
+    }
+    std::cout << '\n';
+  }
+}
@@ -0,0 +1,68 @@
+/**
+ * @file soa_vector_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-27
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "soa_vector.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "testheader/vector_test.hpp"
+
+void soa_vector_test(void) {
+  typedef ft::soa_vector<int, std::string, double> records;
+  typedef records::value_type row;
+
+  std::cout << "\n\n============= soa_vector push_back test "
+               "==============\n";
+  records v;
+  for (int i = 0; i < 5; ++i) {
+    v.push_back(row(i, std::string(i + 1, 'a'), i * 0.5));
+  }
+  v.insert(v.begin() + 1, 2, row(-1, "new"));
+  v.erase(v.begin() + 4);
+  std::cout << "fields : " << records::fields << ", size : " << v.size()
+            << ", capacity >= size : " << (v.capacity() >= v.size()) << '\n';
+  for (records::const_iterator it = v.begin(); it != v.end(); ++it) {
+    std::cout << '(' << (*it).get<0>() << ", " << (*it).get<1>() << ", "
+              << (*it).get<2>() << ") ";
+  }
+  std::cout << '\n';
+
+  std::cout << "\n\n============= soa_vector field access test "
+               "==============\n";
+  // field 하나를 바꾸면 그 column 만 건드린다.
+  v[0].get<2>() = 9.5;
+  v.back() = row(42, "last", 1.25);
+  const int* ids = v.data<0>();
+  int sum = 0;
+  for (records::size_type i = 0; i < v.size(); ++i) {
+    sum += ids[i];
+  }
+  row first = v.front();
+  std::cout << "id sum : " << sum << ", front : (" << first.get<0>() << ", "
+            << first.get<1>() << ", " << first.get<2>() << ")"
+            << ", back : " << v.back().get<1>() << '\n';
+  try {
+    v.at(v.size());
+  } catch (const std::out_of_range& e) {
+    std::cout << e.what() << '\n';
+  }
+
+  std::cout << "\n\n============= soa_vector compare test "
+               "==============\n";
+  records copy(v.begin(), v.end());
+  std::cout << "equal : " << (copy == v);
+  copy[1].get<0>() += 1;
+  std::cout << ", after change : " << (copy == v) << ", less : " << (v < copy)
+            << '\n';
+  copy.resize(2);
+  copy.swap(v);
+  std::cout << "after swap size : " << v.size() << ", " << copy.size()
+            << '\n';
+}
@@ -71,4 +71,5 @@ void std_vector_test(void) {
   std::cout << (void *)ca << '\n';
 
   std::vector<int>::iterator it = hihi.begin();
+  (void)it;
 }
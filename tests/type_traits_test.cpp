@@ -13,6 +13,33 @@
 #include "type_traits.hpp"
 #include "vector.hpp"
 
+struct PodRecord {
+  int id;
+  char name[8];
+};
+
+struct NonTrivial {
+  int* p;
+  NonTrivial(void) : p(new int(0)) {}
+  NonTrivial(const NonTrivial& src) : p(new int(*src.p)) {}
+  NonTrivial& operator=(const NonTrivial& rhs) {
+    *p = *rhs.p;
+    return *this;
+  }
+  ~NonTrivial(void) { delete p; }
+};
+
+// 사용자가 직접 opt-in 하는 경우
+struct OptIn {
+  int value;
+  OptIn(const OptIn& src) : value(src.value) {}
+};
+
+namespace ft {
+template <>
+struct is_trivially_copyable<OptIn> : public true_type {};
+}  // namespace ft
+
 void type_traits_test(void) {
   // std::cout << "is_class type traits test!!\n";
 
@@ -239,5 +266,37 @@ void type_traits_test(void) {
         << "--------------------------------------------------------------\n";
   }
 
+  std::cout
+      << "\n\n==================is_trivially_copyable test==================\n";
+  std::cout << "int : " << ft::is_trivially_copyable<int>::value << '\n';
+  std::cout << "const double : "
+            << ft::is_trivially_copyable<const double>::value << '\n';
+  std::cout << "int* : " << ft::is_trivially_copyable<int*>::value << '\n';
+  std::cout << "PodRecord : " << ft::is_trivially_copyable<PodRecord>::value
+            << '\n';
+  std::cout << "NonTrivial : " << ft::is_trivially_copyable<NonTrivial>::value
+            << '\n';
+  std::cout << "OptIn (specialized) : "
+            << ft::is_trivially_copyable<OptIn>::value << '\n';
+  std::cout << "PodRecord destructible : "
+            << ft::is_trivially_destructible<PodRecord>::value << '\n';
+  std::cout << "NonTrivial destructible : "
+            << ft::is_trivially_destructible<NonTrivial>::value << '\n';
+
+  {
+    // bitwise 경로: 중간 insert / erase 후에도 순서가 유지되어야 한다.
+    ft::vector<int> v;
+    for (int i = 0; i < 10; ++i) {
+      v.push_back(i);
+    }
+    v.reserve(32);
+    v.insert(v.begin() + 2, 3, 100);
+    v.insert(v.begin() + 8, 6, -1);
+    v.erase(v.begin() + 1, v.begin() + 4);
+    v.erase(v.begin());
+    print_vector(v.begin(), v.end());
+    print_vector(v);
+  }
+
   //  system("leaks ft_containers");
 }
@@ -0,0 +1,58 @@
+/**
+ * @file vector_bool_test.cpp
+ * @author jiskim
+ * @brief
+ * @date 2023-02-20
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <iostream>
+
+#include "testheader/vector_test.hpp"
+#include "vector.hpp"
+
+void vector_bool_test(void) {
+  std::cout << "\n\n============= vector<bool> bit packing test "
+               "==============\n";
+  {
+    ft::vector<bool> flags(70, false);
+    flags[3] = true;
+    flags[64] = true;
+    flags.push_back(true);
+    std::cout << std::boolalpha << "flags[3] : " << flags[3]
+              << ", flags[4] : " << flags[4] << ", back : " << flags.back()
+              << '\n';
+    print_vector(flags);
+    flags.insert(flags.begin(), 2, true);
+    flags.erase(flags.begin() + 10);
+    flags[0].flip();
+    print_vector(flags.begin(), flags.begin() + 8);
+  }
+
+  std::cout << "\n\n============= vector<bool> word operation test "
+               "==============\n";
+  {
+    ft::vector<bool> visited(200);
+    for (size_t i = 0; i < visited.size(); i += 30) {
+      visited[i] = true;
+    }
+    std::cout << "count : " << visited.count() << "\nset :";
+    for (size_t i = visited.find_first(); i != visited.npos;
+         i = visited.find_next(i)) {
+      std::cout << ' ' << i;
+    }
+    std::cout << '\n';
+
+    ft::vector<bool> mask(200, true);
+    mask[60] = false;
+    visited &= mask;
+    std::cout << "after &= : " << visited.count() << '\n';
+    visited ^= mask;
+    std::cout << "after ^= : " << visited.count() << '\n';
+    visited.flip();
+    std::cout << "after flip : " << visited.count() << '\n';
+    visited |= mask;
+    std::cout << "after |= : " << visited.count() << '\n';
+  }
+}
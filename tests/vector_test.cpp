@@ -2,11 +2,16 @@
 
 #include <unistd.h>
 
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <list>
+#include <sstream>
 #include <string>
 #include <vector>
 
+#include "parallel_pool.hpp"
+#include "testheader/vector_test.hpp"
 // #include "type_traits.hpp"
 
 class A {
@@ -30,6 +35,22 @@ class Allocated {
   ~Allocated(void) { delete pa; }
 };
 
+static bool is_multiple_of_three(int n) { return n % 3 == 0; }
+
+// 값으로 넘겨지므로 호출 횟수는 밖의 counter 에 센다.
+struct counting_is_odd {
+  size_t* calls;
+
+  bool operator()(int n) const {
+    ++*calls;
+    return n % 2 != 0;
+  }
+};
+
+struct record {
+  char payload[52];
+};
+
 static int num = 0;
 struct BASIC {
   int* a;
@@ -225,4 +246,326 @@ void vector_test(void) {
               << '\n';
     std::cout << (ft_alloc_vec.at(2).pa)->a << '\n';
   }
+
+  std::cout << "\n\n============= realloc_allocator growth test "
+               "==============\n";
+  {
+    ft::vector<int, ft::realloc_allocator<int> > v;
+    for (int i = 0; i < 100000; ++i) {
+      v.push_back(i);
+    }
+    v.insert(v.begin() + 10, 50000, -1);
+    std::cout << "size : " << v.size() << ", capacity : " << v.capacity()
+              << ", v[9] : " << v[9] << ", v[10] : " << v[10]
+              << ", back : " << v.back() << '\n';
+
+    // relocatable 하지 않은 타입은 try_expand 만 사용한다.
+    ft::vector<std::string, ft::realloc_allocator<std::string> > str_vec;
+    for (int i = 0; i < 20000; ++i) {
+      str_vec.push_back("ft_containers");
+    }
+    str_vec.insert(str_vec.begin(), str_vec.back());
+    std::cout << "size : " << str_vec.size() << ", front : " << str_vec.front()
+              << '\n';
+  }
+
+  std::cout << "\n\n============= huge_page_allocator test ==============\n";
+  {
+    // 64KB 부터 huge page 로 mapping
+    ft::vector<long, ft::huge_page_allocator<long, 64 * 1024> > v;
+    for (long i = 0; i < 1000000; ++i) {
+      v.push_back(i);
+    }
+    std::cout << "size : " << v.size() << ", capacity : " << v.capacity()
+              << ", back : " << v.back() << ", 2MB aligned : "
+              << (reinterpret_cast<size_t>(v.data()) % (2 * 1024 * 1024) == 0)
+              << '\n';
+  }
+
+  std::cout << "\n\n============= default init / uninitialized append test "
+               "==============\n";
+  {
+    ft::vector<char> buf(4, 'a');
+    char* region = buf.append_uninitialized(4);
+    for (int i = 0; i < 4; ++i) {
+      region[i] = 'b';
+    }
+    buf.resize_default_init(10);
+    buf[8] = buf[9] = 'c';
+    buf.resize_default_init(8);
+    print_vector(buf.begin(), buf.end());
+    print_vector(buf);
+
+    // trivial 하지 않은 타입은 default constructor 로 생성된다.
+    ft::vector<std::string> strs(1, "first");
+    strs.append_uninitialized(2)->append("second");
+    print_vector(strs.begin(), strs.end());
+  }
+
+  std::cout << "\n\n============= growth policy test ==============\n";
+  {
+    ft::vector<int> v2;
+    ft::vector<int, std::allocator<int>, ft::growth_one_half> v15;
+    ft::vector<int, std::allocator<int>, ft::growth_page_rounded> vpage;
+    ft::vector<int, std::allocator<int>, ft::growth_fixed<10> > vfixed;
+    for (int i = 0; i < 30; ++i) {
+      v2.push_back(i);
+      v15.push_back(i);
+      vpage.push_back(i);
+      vfixed.push_back(i);
+      std::cout << "size " << i + 1 << " -> 2x : " << v2.capacity()
+                << ", 1.5x : " << v15.capacity()
+                << ", page : " << vpage.capacity()
+                << ", fixed<10> : " << vfixed.capacity() << '\n';
+    }
+    // page 를 넘는 block 부터 page 단위로 올림한다.
+    ft::vector<int> big2(1000);
+    ft::vector<int, std::allocator<int>, ft::growth_page_rounded> bigpage(1000);
+    big2.push_back(0);
+    bigpage.push_back(0);
+    std::cout << "size 1001 -> 2x : " << big2.capacity()
+              << ", page : " << bigpage.capacity() << '\n';
+  }
+
+  std::cout << "\n\n============= input iterator insert / assign test "
+               "==============\n";
+  {
+    ft::vector<int> v;
+    for (int i = 0; i < 10; ++i) {
+      v.push_back(i);
+    }
+    std::istringstream records("100 101 102 103");
+    v.insert(v.begin() + 3, std::istream_iterator<int>(records),
+             std::istream_iterator<int>());
+    print_vector(v.begin(), v.end());
+    print_vector(v);
+
+    // 기존 element 보다 짧은 / 긴 range 로 assign
+    std::istringstream shorter("7 8 9");
+    v.assign(std::istream_iterator<int>(shorter), std::istream_iterator<int>());
+    print_vector(v);
+    std::istringstream longer("1 2 3 4 5 6");
+    v.assign(std::istream_iterator<int>(longer), std::istream_iterator<int>());
+    print_vector(v.begin(), v.end());
+    print_vector(v);
+  }
+
+  std::cout << "\n\n============= parallel init test ==============\n";
+  {
+    // 4KB 이상인 fill / copy 를 4개의 thread 로 나눈다.
+    ft::set_parallel_init(4, 4096);
+    ft::vector<long> v(100000, 42L);
+    ft::vector<long> copy(v);
+    copy.assign(150000, 7L);
+    v.resize(200000, 0L);
+    std::cout << "v : " << v.size() << " " << v[0] << " " << v[99999] << " "
+              << v[199999] << ", copy : " << copy.size() << " " << copy[0]
+              << " " << copy.back() << '\n';
+    ft::set_parallel_init(1);
+  }
+
+  std::cout << "\n\n============= zero page value initialization test "
+               "==============\n";
+  {
+    // allocate_zeroed 를 제공하는 allocator 는 0 을 쓰지 않는다.
+    ft::vector<int, ft::realloc_allocator<int> > v(1 << 20);
+    v[10] = 10;
+    v.resize(1 << 21);
+    long sum = 0;
+    for (size_t i = 0; i < v.size(); ++i) {
+      sum += v[i];
+    }
+    std::cout << "size : " << v.size() << ", sum : " << sum << '\n';
+
+    // std::allocator 는 memset 으로 채운다.
+    ft::vector<double> d(1000, 0.0);
+    d.resize(5000);
+    std::cout << "size : " << d.size() << ", back : " << d.back() << '\n';
+  }
+
+  std::cout << "\n\n============= shrink_to_fit / hysteresis test "
+               "==============\n";
+  {
+    ft::vector<int> v(1000, 1);
+    v.erase(v.begin() + 10, v.end());
+    std::cout << "before shrink_to_fit : " << v.capacity();
+    v.shrink_to_fit();
+    std::cout << ", after : " << v.capacity() << '\n';
+    print_vector(v.begin(), v.end());
+
+    // relocatable 하지 않은 타입의 mmap storage 는 page 만 반납한다.
+    ft::vector<std::string, ft::realloc_allocator<std::string> > strs(
+        100000, "peak");
+    strs.resize(2);
+    strs.shrink_to_fit();
+    std::cout << "string size : " << strs.size()
+              << ", capacity : " << strs.capacity() << '\n';
+
+    // size < capacity / 4 가 되면 capacity 를 size * 2 로 줄인다.
+    ft::vector<int, std::allocator<int>, ft::growth_hysteresis<> > h;
+    for (int i = 0; i < 64; ++i) {
+      h.push_back(i);
+    }
+    while (!h.empty()) {
+      h.pop_back();
+      std::cout << h.capacity() << ' ';
+    }
+    std::cout << '\n';
+  }
+
+  std::cout << "\n\n============= swap relocation test ==============\n";
+  {
+    // 안쪽 vector 는 재할당 때 복사되지 않고 swap 으로 옮겨진다.
+    ft::vector<ft::vector<int> > index;
+    index.push_back(ft::vector<int>(3, 42));
+    const int* data = &index[0][0];
+    for (int i = 0; i < 100; ++i) {
+      index.push_back(ft::vector<int>(1, i));
+    }
+    index.erase(index.begin() + 1);
+    std::cout << "same storage : " << (&index[0][0] == data) << '\n';
+    print_vector(index[0].begin(), index[0].end());
+    print_vector(index);
+  }
+
+  std::cout << "\n\n============= erase_if / erase_indices test "
+               "==============\n";
+  {
+    ft::vector<int> sessions;
+    for (int i = 0; i < 20; ++i) {
+      sessions.push_back(i);
+    }
+    const size_t expired = ft::erase_if(sessions, is_multiple_of_three);
+    std::cout << "erased : " << expired << '\n';
+    print_vector(sessions.begin(), sessions.end());
+    const size_t idx[] = {0, 2, 2, 5, 12};
+    std::cout << "erased : "
+              << sessions.erase_indices(idx, idx + sizeof(idx) / sizeof(*idx))
+              << '\n';
+    print_vector(sessions.begin(), sessions.end());
+    print_vector(sessions);
+
+    // pred 는 element 마다 정확히 한 번 불려야 한다.
+    ft::vector<int> numbers;
+    for (int i = 0; i < 10; ++i) {
+      numbers.push_back(i);
+    }
+    size_t calls = 0;
+    counting_is_odd is_odd = {&calls};
+    std::cout << "erased : " << ft::erase_if(numbers, is_odd)
+              << ", pred calls : " << calls << '\n';
+    print_vector(numbers.begin(), numbers.end());
+  }
+
+  std::cout << "\n\n============= usable size capacity test "
+               "==============\n";
+  {
+    // allocator 가 준 block 의 여유분 (malloc size class, page 올림) 까지
+    // capacity 로 쓴다. 늘어난 capacity 만큼은 재할당 없이 채울 수 있다.
+    ft::vector<record, ft::realloc_allocator<record> > records;
+    records.reserve(10000);  // 520000 byte, mmap
+    const record* data = records.data();
+    const size_t cap = records.capacity();
+    records.resize(cap);
+    std::cout << "capacity : " << cap << ", filled without move : "
+              << (records.data() == data) << '\n';
+
+    ft::vector<int, ft::realloc_allocator<int> > small;
+    small.reserve(5);
+    std::cout << "small capacity >= 5 : " << (small.capacity() >= 5) << '\n';
+  }
+
+  std::cout << "\n\n============= adopt / release test ==============\n";
+  {
+    // decoder 가 할당해서 채운 buffer 를 복사 없이 넘겨받는다.
+    std::allocator<std::string> alloc;
+    std::string* decoded = alloc.allocate(8);
+    for (int i = 0; i < 3; ++i) {
+      new (decoded + i) std::string(1, static_cast<char>('a' + i));
+    }
+    ft::vector<std::string> msg(2, "old");
+    msg.adopt(decoded, 3, 8);
+    msg.push_back("d");
+    std::cout << "same storage : " << (msg.data() == decoded)
+              << ", size : " << msg.size() << ", capacity : " << msg.capacity()
+              << '\n';
+    print_vector(msg.begin(), msg.end());
+
+    const size_t size = msg.size();
+    const size_t cap = msg.capacity();
+    std::string* out = msg.release();
+    std::cout << "released : " << (out == decoded) << ", empty : "
+              << msg.empty() << ", capacity : " << msg.capacity() << '\n';
+    ft::vector<std::string> next;
+    next.adopt(out, size, cap);
+    print_vector(next);
+
+    try {
+      next.adopt(NULL, 1, 0);
+    } catch (const std::invalid_argument& e) {
+      std::cout << e.what() << ", size : " << next.size() << '\n';
+    }
+  }
+
+  std::cout << "\n\n============= append_from_fd / write_to_fd test "
+               "==============\n";
+  {
+    int fds[2];
+    if (pipe(fds) == 0) {
+      ft::vector<ft::vector<char> > lines;
+      const char* words[] = {"GET ", "/index.html", "", " HTTP/1.1\n"};
+      for (int i = 0; i < 4; ++i) {
+        lines.push_back(
+            ft::vector<char>(words[i], words[i] + std::strlen(words[i])));
+      }
+      std::cout << "writev : "
+                << ft::write_to_fd(fds[1], lines.begin(), lines.end())
+                << ", write : " << lines[1].write_to_fd(fds[1]) << '\n';
+      close(fds[1]);
+
+      ft::vector<char> received;
+      ssize_t n;
+      while ((n = received.append_from_fd(fds[0], 8)) > 0) {
+        std::cout << "read " << n << " bytes, size : " << received.size()
+                  << '\n';
+      }
+      close(fds[0]);
+      std::cout << std::string(received.begin(), received.end()) << '\n';
+      std::cout << "bad fd : " << received.append_from_fd(-1, 8)
+                << ", size : " << received.size() << '\n';
+    }
+  }
+
+#if FT_HAS_MOVE
+  std::cout << "\n\n============= move constructor / assignment test "
+               "==============\n";
+  {
+    ft::vector<std::string> src(3, "moved");
+    const std::string* data = &src[0];
+    ft::vector<std::string> dst(std::move(src));
+    std::cout << "stolen : " << (&dst[0] == data)
+              << ", source size : " << src.size() << '\n';
+
+    ft::vector<std::string> other(10, "old");
+    other = std::move(dst);
+    std::cout << "stolen : " << (&other[0] == data)
+              << ", source size : " << dst.size() << '\n';
+    print_vector(other.begin(), other.end());
+    print_vector(other);
+  }
+
+  std::cout << "\n\n============= move_if_noexcept relocation test "
+               "==============\n";
+  {
+    // 재할당과 insert 의 shift 에서 내부 vector 의 storage 는 그대로 옮겨진다.
+    ft::vector<ft::vector<int> > nested;
+    nested.push_back(ft::vector<int>(3, 7));
+    const int* data = &nested[0][0];
+    for (int i = 0; i < 100; ++i) {
+      nested.insert(nested.begin(), ft::vector<int>(1, i));
+    }
+    std::cout << "same storage : " << (&nested.back()[0] == data) << '\n';
+    print_vector(nested.back().begin(), nested.back().end());
+  }
+#endif
 }